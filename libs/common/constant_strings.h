@@ -126,6 +126,7 @@ ASTR(ArnoldUsd);
 ASTR(ArnoldNodeGraph);
 ASTR(ArnoldOptions);
 ASTR(ArnoldMarkPrimsDirty);
+ASTR(ArnoldMarkRprimTypesDirty);
 ASTR(binary);
 ASTR(BOOL);
 ASTR(BYTE);
@@ -466,6 +467,7 @@ ASTR(region_min_x);
 ASTR(region_min_y);
 ASTR(render_device);
 ASTR(render_outputs);
+ASTR(render_param_pointer);
 ASTR(render_pass);
 ASTR(render_settings);
 ASTR(request_imager_update);
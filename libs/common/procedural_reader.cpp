@@ -4,6 +4,7 @@
 
 #include "procedural_reader.h"
 #include "diagnostic_utils.h"
+#include "profile_utils.h"
 #include "trace_utils.h"
 #include <ai.h>
 #include <pxr/usd/usd/stage.h>
@@ -22,6 +23,7 @@ void ProceduralReader::Read(const std::string &filename,
     // Install diagnostic delegate to capture USD composition errors
     ArnoldUsdDiagnostic diagnostic;
     ArnoldUsdTraceDiagnostic traceDiagnostic;
+    ArnoldUsdProfileReport profileReport;
     
     // Nodes were already exported, should we skip here,
     // or should we just append the new nodes ?
@@ -0,0 +1,194 @@
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "profile_utils.h"
+
+#include <ai.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct ProfileEntry {
+    uint64_t count = 0;
+    double totalTime = 0.0; // milliseconds
+    double maxTime = 0.0;
+    int64_t memory = 0;
+    size_t threads = 0;
+    std::chrono::steady_clock::time_point firstStart;
+    std::chrono::steady_clock::time_point lastEnd;
+
+    void Merge(const ProfileEntry &other)
+    {
+        if (count == 0 || other.firstStart < firstStart)
+            firstStart = other.firstStart;
+        if (count == 0 || other.lastEnd > lastEnd)
+            lastEnd = other.lastEnd;
+        count += other.count;
+        totalTime += other.totalTime;
+        maxTime = std::max(maxTime, other.maxTime);
+        memory += other.memory;
+        threads += other.threads;
+    }
+};
+
+using ProfileEntries = std::map<std::string, ProfileEntry>;
+using ProfileCategories = std::map<std::string, ProfileEntries>;
+
+// Statistics recorded by a single thread. The mutex is only contended while the report is written,
+// so the threads reading prims in parallel don't wait for each other.
+struct ThreadProfileData {
+    AtMutex mutex;
+    ProfileCategories categories;
+};
+
+struct ProfileData {
+    AtMutex mutex;
+    // The thread data is shared with the thread_local pointers, so it's kept after the threads exit.
+    std::vector<std::shared_ptr<ThreadProfileData>> threads;
+};
+
+ProfileData &GetProfileData()
+{
+    static ProfileData s_profileData;
+    return s_profileData;
+}
+
+ThreadProfileData &GetThreadProfileData()
+{
+    thread_local std::shared_ptr<ThreadProfileData> s_threadData = []() {
+        auto threadData = std::make_shared<ThreadProfileData>();
+        ProfileData &data = GetProfileData();
+        std::lock_guard<AtMutex> guard(data.mutex);
+        data.threads.push_back(threadData);
+        return threadData;
+    }();
+    return *s_threadData;
+}
+
+const std::string &GetProfileFilename()
+{
+    static const std::string s_filename = []() {
+        const char *envVar = std::getenv("ARNOLD_USD_PROFILE");
+        return std::string(envVar ? envVar : "");
+    }();
+    return s_filename;
+}
+
+void WriteJsonString(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for (const char c : str) {
+        if (c == '"' || c == '\\')
+            os << '\\';
+        os << c;
+    }
+    os << '"';
+}
+
+} // namespace
+
+bool ArnoldUsdProfiler::IsEnabled() { return !GetProfileFilename().empty(); }
+
+void ArnoldUsdProfiler::Record(const char *category, const std::string &name,
+    std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end, int64_t memoryDelta)
+{
+    const double elapsed = std::chrono::duration<double, std::milli>(end - start).count();
+    ThreadProfileData &data = GetThreadProfileData();
+    std::lock_guard<AtMutex> guard(data.mutex);
+    ProfileEntry &entry = data.categories[category][name];
+    if (entry.count == 0 || start < entry.firstStart)
+        entry.firstStart = start;
+    if (entry.count == 0 || end > entry.lastEnd)
+        entry.lastEnd = end;
+    entry.count++;
+    entry.totalTime += elapsed;
+    entry.maxTime = std::max(entry.maxTime, elapsed);
+    entry.memory += memoryDelta;
+    entry.threads = 1;
+}
+
+void ArnoldUsdProfiler::WriteReport()
+{
+    const std::string &filename = GetProfileFilename();
+    if (filename.empty())
+        return;
+
+    // Merge the statistics of all the threads. The global lock also prevents
+    // several procedurals from writing the file at the same time.
+    ProfileData &data = GetProfileData();
+    std::lock_guard<AtMutex> guard(data.mutex);
+    ProfileCategories categories;
+    for (const auto &threadData : data.threads) {
+        std::lock_guard<AtMutex> threadGuard(threadData->mutex);
+        for (const auto &category : threadData->categories) {
+            ProfileEntries &entries = categories[category.first];
+            for (const auto &it : category.second)
+                entries[it.first].Merge(it.second);
+        }
+    }
+    std::ofstream os(filename);
+    if (!os.is_open()) {
+        AiMsgWarning("[usd] Unable to write the profile report %s", filename.c_str());
+        return;
+    }
+    os << "{";
+    bool firstCategory = true;
+    for (const auto &category : categories) {
+        os << (firstCategory ? "\n  " : ",\n  ");
+        firstCategory = false;
+        WriteJsonString(os, category.first);
+        os << ": {";
+        bool firstEntry = true;
+        for (const auto &it : category.second) {
+            const ProfileEntry &entry = it.second;
+            const double wallTime = std::chrono::duration<double, std::milli>(entry.lastEnd - entry.firstStart).count();
+            os << (firstEntry ? "\n    " : ",\n    ");
+            firstEntry = false;
+            WriteJsonString(os, it.first);
+            os << ": {\"count\": " << entry.count << ", \"total_ms\": " << entry.totalTime
+               << ", \"max_ms\": " << entry.maxTime << ", \"wall_ms\": " << wallTime
+               << ", \"threads\": " << entry.threads
+               << ", \"utilization\": " << (wallTime > 0.0 ? entry.totalTime / wallTime : 0.0)
+               << ", \"memory_bytes\": " << entry.memory << "}";
+        }
+        os << (firstEntry ? "}" : "\n  }");
+    }
+    os << "\n}\n";
+}
+
+ArnoldUsdProfileScope::ArnoldUsdProfileScope(const char *category, const char *name, bool trackMemory)
+{
+    if (!ArnoldUsdProfiler::IsEnabled())
+        return;
+    _enabled = true;
+    _category = category;
+    _name = name;
+    if (trackMemory)
+        _startMemory = static_cast<int64_t>(AiMsgUtilGetUsedMemory());
+    _start = std::chrono::steady_clock::now();
+}
+
+ArnoldUsdProfileScope::ArnoldUsdProfileScope(const char *category, const std::string &name, bool trackMemory)
+    : ArnoldUsdProfileScope(category, name.c_str(), trackMemory)
+{
+}
+
+ArnoldUsdProfileScope::~ArnoldUsdProfileScope()
+{
+    if (!_enabled)
+        return;
+    const auto end = std::chrono::steady_clock::now();
+    const int64_t memoryDelta =
+        _startMemory >= 0 ? static_cast<int64_t>(AiMsgUtilGetUsedMemory()) - _startMemory : 0;
+    ArnoldUsdProfiler::Record(_category, _name, _start, end, memoryDelta);
+}
+
+ArnoldUsdProfileReport::~ArnoldUsdProfileReport() { ArnoldUsdProfiler::WriteReport(); }
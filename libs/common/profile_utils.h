@@ -0,0 +1,75 @@
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef PROFILE_UTILS_H
+#define PROFILE_UTILS_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/// Aggregated statistics of the usd translation, grouped by category (reader phases,
+/// primitive types, hydra prim syncs, ...).
+///
+/// Activated only when the environment variable ARNOLD_USD_PROFILE is set to the path of
+/// a json file. For every entry we store the amount of calls, the total and maximum
+/// time, the amount of threads that did the work and the elapsed time between the
+/// first call and the end of the last one, which gives the average thread utilization.
+/// Phases also store the difference of memory used by Arnold, since it can't be attributed
+/// to a given primitive when they're read in parallel.
+///
+/// Statistics are accumulated per thread, so recording doesn't serialize the parallel reader,
+/// and merged over all the procedurals of the process when the json file is rewritten,
+/// every time one of them finished reading its stage.
+class ArnoldUsdProfiler
+{
+public:
+    static bool IsEnabled();
+    static void Record(const char *category, const std::string &name,
+        std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end,
+        int64_t memoryDelta = 0);
+    /// Dump the current statistics to the file given by ARNOLD_USD_PROFILE
+    static void WriteReport();
+};
+
+/// RAII object recording the time spent in its scope.
+///
+/// \code
+/// void HdArnoldMesh::Sync(...)
+/// {
+///     ArnoldUsdProfileScope profileScope("sync", "HdArnoldMesh");
+///     ...
+/// }
+/// \endcode
+class ArnoldUsdProfileScope
+{
+public:
+    ArnoldUsdProfileScope(const char *category, const char *name, bool trackMemory = false);
+    ArnoldUsdProfileScope(const char *category, const std::string &name, bool trackMemory = false);
+    ~ArnoldUsdProfileScope();
+
+    ArnoldUsdProfileScope(const ArnoldUsdProfileScope&) = delete;
+    ArnoldUsdProfileScope& operator=(const ArnoldUsdProfileScope&) = delete;
+
+private:
+    const char *_category = nullptr;
+    std::string _name;
+    std::chrono::steady_clock::time_point _start;
+    int64_t _startMemory = -1;
+    bool _enabled = false;
+};
+
+/// RAII object writing the profile report when it goes out of scope,
+/// used in ProceduralReader::Read next to ArnoldUsdTraceDiagnostic.
+class ArnoldUsdProfileReport
+{
+public:
+    ArnoldUsdProfileReport() = default;
+    ~ArnoldUsdProfileReport();
+
+    ArnoldUsdProfileReport(const ArnoldUsdProfileReport&) = delete;
+    ArnoldUsdProfileReport& operator=(const ArnoldUsdProfileReport&) = delete;
+};
+
+#endif // PROFILE_UTILS_H
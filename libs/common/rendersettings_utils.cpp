@@ -409,7 +409,41 @@ void ComputeMotionRange(UsdStageRefPtr _stage, const UsdPrim &options,  TimeSett
     }
 }
 
-void ChooseRenderSettings(UsdStageRefPtr _stage, std::string &_renderSettings, TimeSettings &_time, UsdPrim *rootPrimPtr) {
+ArnoldUsdStageRenderPrims::ArnoldUsdStageRenderPrims(UsdStageRefPtr stage)
+{
+    if (stage) {
+        _range = stage->Traverse();
+        _iter = _range.begin();
+    }
+}
+
+const SdfPath &ArnoldUsdStageRenderPrims::GetFirstCamera()
+{
+    _TraverseUntil(_camera);
+    return _camera;
+}
+
+const SdfPath &ArnoldUsdStageRenderPrims::GetFirstRenderSettings()
+{
+    _TraverseUntil(_renderSettings);
+    return _renderSettings;
+}
+
+void ArnoldUsdStageRenderPrims::_TraverseUntil(const SdfPath &target)
+{
+    // Both lookups share the same iterator, and each of them remembers the 
+    // first prim of its type that was met while searching for the other one
+    for (; target.IsEmpty() && _iter != _range.end(); ++_iter) {
+        const UsdPrim &prim(*_iter);
+        if (_camera.IsEmpty() && prim.IsA<UsdGeomCamera>())
+            _camera = prim.GetPath();
+        else if (_renderSettings.IsEmpty() && (prim.IsA<UsdRenderSettings>() || prim.GetTypeName() == str::t_ArnoldOptions))
+            _renderSettings = prim.GetPath();
+    }
+}
+
+void ChooseRenderSettings(UsdStageRefPtr _stage, std::string &_renderSettings, TimeSettings &_time, UsdPrim *rootPrimPtr,
+    ArnoldUsdStageRenderPrims *renderPrims) {
 
     if (!_stage) return;
 
@@ -451,16 +485,11 @@ void ChooseRenderSettings(UsdStageRefPtr _stage, std::string &_renderSettings, T
                 }
             } else {
                 // less efficient use case, we didn't find any options so far so we're going to 
-                // traverse the whole stage, and stop at the first RenderSettings / ArnoldOptions primitive we find
-                UsdPrimRange range = _stage->Traverse();
-                for (auto iter = range.begin(); iter != range.end(); ++iter) {
-                    const UsdPrim &prim(*iter);
-                    if (prim.IsA<UsdRenderSettings>() || prim.GetTypeName() == str::t_ArnoldOptions) {
-                        _renderSettings = prim.GetPath().GetString();
-                        //ComputeMotionRange(_stage, prim, _time);
-                        break;
-                    }
-                }
+                // traverse the stage, and stop at the first RenderSettings / ArnoldOptions primitive we find
+                ArnoldUsdStageRenderPrims localRenderPrims(_stage);
+                const SdfPath &renderSettingsPath = (renderPrims ? renderPrims : &localRenderPrims)->GetFirstRenderSettings();
+                if (!renderSettingsPath.IsEmpty())
+                    _renderSettings = renderSettingsPath.GetString();
             }
         }
     }
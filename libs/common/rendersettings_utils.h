@@ -4,6 +4,7 @@
 
 #pragma once
 #include <pxr/pxr.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 #include <ai.h>
 #include "timesettings.h"
@@ -28,7 +29,29 @@ struct ArnoldAOVTypes {
 
 ArnoldAOVTypes GetArnoldTypesFromFormatToken(const TfToken& type);
 
-void ChooseRenderSettings(UsdStageRefPtr stage, std::string &renderSettingsPath, TimeSettings &_time, UsdPrim *rootPrimPtr=nullptr);
+/// Index of the first camera and the first render settings primitive found in a stage. 
+/// Both are looked up lazily with a single traversal, that is resumed where the previous 
+/// query stopped, so that a stage is traversed at most once whatever the amount of queries.
+class ArnoldUsdStageRenderPrims {
+public:
+    ArnoldUsdStageRenderPrims(UsdStageRefPtr stage);
+
+    /// First UsdGeomCamera of the stage, or an empty path if there is none.
+    const SdfPath &GetFirstCamera();
+    /// First RenderSettings or ArnoldOptions primitive of the stage, or an empty path if there is none.
+    const SdfPath &GetFirstRenderSettings();
+
+private:
+    void _TraverseUntil(const SdfPath &target);
+
+    UsdPrimRange _range;
+    UsdPrimRange::iterator _iter;
+    SdfPath _camera;
+    SdfPath _renderSettings;
+};
+
+void ChooseRenderSettings(UsdStageRefPtr stage, std::string &renderSettingsPath, TimeSettings &_time, 
+    UsdPrim *rootPrimPtr=nullptr, ArnoldUsdStageRenderPrims *renderPrims=nullptr);
 AtNode* ReadRenderSettings(const UsdPrim &renderSettingsPrim, ArnoldAPIAdapter &context, ProceduralReader *reader, const TimeSettings &time, AtUniverse *universe, SdfPath& camera);
 void ComputeMotionRange(UsdStageRefPtr _stage, const UsdPrim &options,  TimeSettings &_time);
 void ComputeUsdLuxVersion(UsdStageRefPtr _stage, const UsdPrim &options,  TimeSettings &_time, const AtUniverse *universe);
@@ -29,8 +29,12 @@
 #include <pxr/base/gf/vec4h.h>
 #include <pxr/base/gf/matrix4f.h>
 #include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/quath.h>
 
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -117,14 +121,29 @@ void ArnoldUsdCurvesData::InitVertexCounts()
 
     const unsigned int numVertexCounts = _vertexCounts.size();
     _arnoldVertexCounts.resize(numVertexCounts);
+    _originalOffsets.resize(numVertexCounts);
+    _arnoldOffsets.resize(numVertexCounts);
     for (unsigned int i = 0; i < numVertexCounts; i++) {
         const int numSegments = (_vertexCounts[i] - _vmin) / _vstep + 1;
+        _originalOffsets[i] = static_cast<size_t>(_numPoints);
+        _arnoldOffsets[i] = static_cast<size_t>(_numPerVertex);
         _arnoldVertexCounts[i] = numSegments + 1;
         _numPerVertex += numSegments + 1;
         _numPoints += _vertexCounts[i];
     }
 }
 
+void ArnoldUsdCurvesData::SetBasis(int vmin, int vstep)
+{
+    _vmin = vmin;
+    _vstep = vstep;
+    _numPerVertex = 0;
+    _numPoints = 0;
+    _arnoldVertexCounts = VtIntArray();
+    _originalOffsets.clear();
+    _arnoldOffsets.clear();
+}
+
 /// Sets radius attribute on an Arnold shape from a VtValue holding VtFloatArray. We expect this to be a width value,
 /// so a (*0.5) function will be applied to the values.
 ///
@@ -436,4 +455,178 @@ bool MeshHoleFilter::FilterFaceVaryingValue(VtValue& value) const
            _TryFilterFaceVarying<std::string>(*this, value);
 }
 
+namespace {
+
+// Below this amount of elements, spawning tasks costs more than the conversion itself.
+constexpr size_t _gaussianSplatGrainSize = 1 << 16;
+
+template <typename F>
+inline void _GaussianSplatParallelFor(size_t count, F&& fn)
+{
+    if (count < _gaussianSplatGrainSize)
+        fn(0, count);
+    else
+        WorkParallelForN(count, std::forward<F>(fn));
+}
+
+template <typename T>
+AtArray* _ConvertGaussianSplatVectors(const VtArray<T>& values, uint8_t arnoldType)
+{
+    const size_t count = values.size();
+    AtArray* array = AiArrayAllocate(count, 1, arnoldType);
+    GfVec3f* out = static_cast<GfVec3f*>(AiArrayMap(array));
+    const T* in = values.cdata();
+    _GaussianSplatParallelFor(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            out[i] = GfVec3f(in[i]);
+    });
+    AiArrayUnmap(array);
+    return array;
+}
+
+template <typename Q>
+AtArray* _ConvertGaussianSplatRotations(const VtArray<Q>& values)
+{
+    const size_t count = values.size();
+    AtArray* array = AiArrayAllocate(count * 4, 1, AI_TYPE_FLOAT);
+    float* out = static_cast<float*>(AiArrayMap(array));
+    const Q* in = values.cdata();
+    _GaussianSplatParallelFor(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& imaginary = in[i].GetImaginary();
+            float* rotation = out + i * 4;
+            rotation[0] = static_cast<float>(imaginary[0]);
+            rotation[1] = static_cast<float>(imaginary[1]);
+            rotation[2] = static_cast<float>(imaginary[2]);
+            rotation[3] = static_cast<float>(in[i].GetReal());
+        }
+    });
+    AiArrayUnmap(array);
+    return array;
+}
+
+template <typename T>
+AtArray* _ConvertGaussianSplatShCoefficients(const VtArray<T>& values, size_t numPoints)
+{
+    const size_t count = values.size();
+    size_t coeffsPerPoint = 0;
+    if (numPoints > 0 && count % numPoints == 0) {
+        coeffsPerPoint = count / numPoints;
+        // Valid SH coefficient counts per point: 1 (deg 0), 4, 9, 16 (deg 1-3)
+        if (coeffsPerPoint != 1 && coeffsPerPoint != 4 && coeffsPerPoint != 9 && coeffsPerPoint != 16)
+            coeffsPerPoint = 0;
+    }
+    AtArray* array = AiArrayAllocate(count, 1, AI_TYPE_RGB);
+    GfVec3f* out = static_cast<GfVec3f*>(AiArrayMap(array));
+    const T* in = values.cdata();
+    if (coeffsPerPoint == 0) {
+        _GaussianSplatParallelFor(count, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                out[i] = GfVec3f(in[i]);
+        });
+    } else {
+        constexpr float C0 = 0.28209479177387814f;
+        _GaussianSplatParallelFor(numPoints, [&](size_t begin, size_t end) {
+            for (size_t p = begin; p < end; ++p) {
+                const size_t first = p * coeffsPerPoint;
+                out[first] = GfVec3f(in[first]) * C0 + GfVec3f(0.5f);
+                for (size_t i = first + 1; i < first + coeffsPerPoint; ++i)
+                    out[i] = GfVec3f(in[i]);
+            }
+        });
+    }
+    AiArrayUnmap(array);
+    return array;
+}
+
+} // namespace
+
+bool ArnoldUsdSetGaussianSplatVectors(AtNode* node, const AtString& paramName, const VtValue& value)
+{
+    AtArray* array = nullptr;
+    if (value.IsHolding<VtVec3fArray>()) {
+        const auto& v = value.UncheckedGet<VtVec3fArray>();
+        if (!v.empty())
+            array = AiArrayConvert(v.size(), 1, AI_TYPE_VECTOR, v.cdata());
+    } else if (value.IsHolding<VtVec3hArray>()) {
+        const auto& v = value.UncheckedGet<VtVec3hArray>();
+        if (!v.empty())
+            array = _ConvertGaussianSplatVectors(v, AI_TYPE_VECTOR);
+    }
+    if (array == nullptr)
+        return false;
+    AiNodeSetArray(node, paramName, array);
+    return true;
+}
+
+bool ArnoldUsdSetGaussianSplatOpacities(AtNode* node, const VtValue& value)
+{
+    AtArray* array = nullptr;
+    if (value.IsHolding<VtFloatArray>()) {
+        const auto& v = value.UncheckedGet<VtFloatArray>();
+        if (!v.empty())
+            array = AiArrayConvert(v.size(), 1, AI_TYPE_FLOAT, v.cdata());
+    } else if (value.IsHolding<VtHalfArray>()) {
+        const auto& v = value.UncheckedGet<VtHalfArray>();
+        if (!v.empty()) {
+            const size_t count = v.size();
+            array = AiArrayAllocate(count, 1, AI_TYPE_FLOAT);
+            float* out = static_cast<float*>(AiArrayMap(array));
+            const GfHalf* in = v.cdata();
+            _GaussianSplatParallelFor(count, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                    out[i] = static_cast<float>(in[i]);
+            });
+            AiArrayUnmap(array);
+        }
+    }
+    if (array == nullptr)
+        return false;
+    AiNodeSetArray(node, str::gs_opacity, array);
+    return true;
+}
+
+bool ArnoldUsdSetGaussianSplatRotations(AtNode* node, const VtValue& value)
+{
+    AtArray* array = nullptr;
+    if (value.IsHolding<VtQuatfArray>()) {
+        const auto& v = value.UncheckedGet<VtQuatfArray>();
+        if (!v.empty())
+            array = _ConvertGaussianSplatRotations(v);
+    } else if (value.IsHolding<VtQuathArray>()) {
+        const auto& v = value.UncheckedGet<VtQuathArray>();
+        if (!v.empty())
+            array = _ConvertGaussianSplatRotations(v);
+    }
+    if (array == nullptr)
+        return false;
+    AiNodeSetArray(node, str::gs_rotation, array);
+    return true;
+}
+
+bool ArnoldUsdSetGaussianSplatShCoefficients(AtNode* node, const VtValue& value, bool normalizeDc)
+{
+    size_t numPoints = 0;
+    if (normalizeDc) {
+        const AtArray* points = AiNodeGetArray(node, str::points);
+        numPoints = points ? AiArrayGetNumElements(points) : 0;
+    }
+    AtArray* array = nullptr;
+    if (value.IsHolding<VtVec3fArray>()) {
+        const auto& v = value.UncheckedGet<VtVec3fArray>();
+        if (!v.empty())
+            array = numPoints > 0 ? _ConvertGaussianSplatShCoefficients(v, numPoints)
+                                  : AiArrayConvert(v.size(), 1, AI_TYPE_RGB, v.cdata());
+    } else if (value.IsHolding<VtVec3hArray>()) {
+        const auto& v = value.UncheckedGet<VtVec3hArray>();
+        if (!v.empty())
+            array = numPoints > 0 ? _ConvertGaussianSplatShCoefficients(v, numPoints)
+                                  : _ConvertGaussianSplatVectors(v, AI_TYPE_RGB);
+    }
+    if (array == nullptr)
+        return false;
+    AiNodeSetArray(node, str::gs_sh, array);
+    return true;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -25,6 +25,9 @@
 #include <pxr/base/vt/value.h>
 
 #include <pxr/base/arch/export.h>
+#include <pxr/base/work/loops.h>
+
+#include <vector>
 
 #include "common_utils.h"
 
@@ -60,7 +63,16 @@ public:
     ~ArnoldUsdCurvesData() = default;
 
     /// Initialize Arnold Vertex Counts using vmin/vstep and the USD vertex counts.
+    ///
+    /// The per curve offsets in the USD and Arnold arrays are computed at the same time, so they
+    /// are shared by every primvar remapped with this object.
     void InitVertexCounts();
+    /// Invalidate the precomputed vertex counts after the topology changed.
+    ///
+    /// The USD vertex counts are still referenced, so they are expected to be updated in place.
+    /// @param vmin Minimum number of vertices per segment.
+    /// @param vstep Number of vertices needed to increase segment count by one.
+    void SetBasis(int vmin, int vstep);
     /// Set the Arnold curves radius from a VtValue.
     ///
     /// @param node Arnold node to set the radius on.
@@ -92,33 +104,47 @@ public:
             // need to do any remapping
             return true;
         }
+        if (Ai_unlikely(static_cast<int>(original.size()) < _numPoints)) {
+            // Not enough values for the curves, we would read past the end of the array
+            return true;
+        }
         VtArray<T> remapped(_numPerVertex);
-        const auto* originalP = original.data();
-        auto* remappedP = remapped.data();
+        const auto* originalData = original.data();
+        auto* remappedData = remapped.data();
         // We use the first and the last item for each curve and using the CanInterpolate type.
         // - Interpolate values if we can interpolate the type.
         // - Look for the closest one if we can't interpolate the type.
-        for (auto curve = decltype(numVertexCounts){0}; curve < numVertexCounts; curve += 1) {
-            const auto originalVertexCount = _vertexCounts[curve];
-            const auto arnoldVertexCount = _arnoldVertexCounts[curve];
-            const auto arnoldVertexCountMinusOne = arnoldVertexCount - 1;
-            const auto originalVertexCountMinusOne = originalVertexCount - 1;
-            *remappedP = *originalP;
-            remappedP[arnoldVertexCountMinusOne] = originalP[originalVertexCountMinusOne];
-
-            // The original vertex count should always be more than the
-            if (arnoldVertexCount > 2) {
-                for (auto i = 1; i < arnoldVertexCountMinusOne; i += 1) {
-                    // Convert i to a range of 0..1.
-                    const auto arnoldVertex = static_cast<float>(i) / static_cast<float>(arnoldVertexCountMinusOne);
-                    const auto originalVertex = arnoldVertex * static_cast<float>(originalVertexCountMinusOne);
-                    // AiLerp fails with string and other types, so we have to make sure it's not being called based
-                    // on the type, so using a partial template specialization, that does not work with functions.
-                    RemapVertexPrimvar<T>::fn(remappedP[i], originalP, originalVertex);
+        // Curves are independent from each other, so they are remapped in parallel by ranges of curves.
+        auto remapCurves = [&](size_t begin, size_t end) {
+            for (auto curve = begin; curve < end; curve += 1) {
+                const auto* originalP = originalData + _originalOffsets[curve];
+                auto* remappedP = remappedData + _arnoldOffsets[curve];
+                const auto originalVertexCount = _vertexCounts[curve];
+                const auto arnoldVertexCount = _arnoldVertexCounts[curve];
+                const auto arnoldVertexCountMinusOne = arnoldVertexCount - 1;
+                const auto originalVertexCountMinusOne = originalVertexCount - 1;
+                *remappedP = *originalP;
+                remappedP[arnoldVertexCountMinusOne] = originalP[originalVertexCountMinusOne];
+
+                // The original vertex count should always be more than the
+                if (arnoldVertexCount > 2) {
+                    for (auto i = 1; i < arnoldVertexCountMinusOne; i += 1) {
+                        // Convert i to a range of 0..1.
+                        const auto arnoldVertex = static_cast<float>(i) / static_cast<float>(arnoldVertexCountMinusOne);
+                        const auto originalVertex = arnoldVertex * static_cast<float>(originalVertexCountMinusOne);
+                        // AiLerp fails with string and other types, so we have to make sure it's not being called
+                        // based on the type, so using a partial template specialization, that does not work with
+                        // functions.
+                        RemapVertexPrimvar<T>::fn(remappedP[i], originalP, originalVertex);
+                    }
                 }
             }
-            originalP += originalVertexCount;
-            remappedP += arnoldVertexCount;
+        };
+        // Below this amount of values, spawning tasks costs more than the remapping itself.
+        if (_numPerVertex < _remapGrainSize) {
+            remapCurves(0, numVertexCounts);
+        } else {
+            WorkParallelForN(numVertexCounts, remapCurves);
         }
 
         // This is the one we are supposed to use when it's expensive to copy objects to VtValue and we don't care
@@ -145,6 +171,10 @@ private:
     int _vstep;                      ///< Number of vertices needed to increase segment count by one.
     int _numPerVertex;               ///< Number of per vertex values.
     int _numPoints;                  ///< Total amount of vertices.
+    std::vector<size_t> _originalOffsets; ///< Offset of the first USD vertex of each curve.
+    std::vector<size_t> _arnoldOffsets;   ///< Offset of the first Arnold vertex of each curve.
+
+    static constexpr int _remapGrainSize = 1 << 16;
 
     template <typename T0, typename... T>
     struct IsAny : std::false_type {
@@ -343,4 +373,48 @@ private:
     size_t _holeCount = 0;         ///< Number of unique hole faces.
 };
 
+/// Set a vector array of a gaussian splat, like points or gs_scale, from a Usd or a Hydra value.
+///
+/// Splat clouds can have tens of millions of elements, so half precision values are converted
+/// in parallel directly into the mapped Arnold array, without intermediate copies.
+///
+/// @param node Arnold points node in gaussian mode.
+/// @param paramName Name of the Arnold parameter to set.
+/// @param value VtValue holding a VtVec3fArray or a VtVec3hArray.
+/// @return True if the array was set, false if the value is empty or of an unsupported type.
+ARCH_HIDDEN
+bool ArnoldUsdSetGaussianSplatVectors(AtNode* node, const AtString& paramName, const VtValue& value);
+
+/// Set gs_opacity of a gaussian splat from a Usd or a Hydra value.
+///
+/// @param node Arnold points node in gaussian mode.
+/// @param value VtValue holding a VtFloatArray or a VtHalfArray.
+/// @return True if the array was set, false if the value is empty or of an unsupported type.
+ARCH_HIDDEN
+bool ArnoldUsdSetGaussianSplatOpacities(AtNode* node, const VtValue& value);
+
+/// Set gs_rotation of a gaussian splat from a Usd or a Hydra value.
+///
+/// Arnold stores 4 floats per splat as [x, y, z, w], while GfQuat stores the real part separately.
+///
+/// @param node Arnold points node in gaussian mode.
+/// @param value VtValue holding a VtQuatfArray or a VtQuathArray.
+/// @return True if the array was set, false if the value is empty or of an unsupported type.
+ARCH_HIDDEN
+bool ArnoldUsdSetGaussianSplatRotations(AtNode* node, const VtValue& value);
+
+/// Set gs_sh of a gaussian splat from a Usd or a Hydra value.
+///
+/// Arnold expects the DC coefficient (the first one of each splat) to be stored as
+/// (raw_dc * C0 + 0.5), whereas radiance:sphericalHarmonicsCoefficients stores raw coefficients.
+/// When @p normalizeDc is true, the DC term is transformed while the values are copied, using
+/// the amount of points already set on the node to find the amount of coefficients per splat.
+///
+/// @param node Arnold points node in gaussian mode, with its points already set.
+/// @param value VtValue holding a VtVec3fArray or a VtVec3hArray.
+/// @param normalizeDc Whether the DC coefficient has to be normalized.
+/// @return True if the array was set, false if the value is empty or of an unsupported type.
+ARCH_HIDDEN
+bool ArnoldUsdSetGaussianSplatShCoefficients(AtNode* node, const VtValue& value, bool normalizeDc);
+
 PXR_NAMESPACE_CLOSE_SCOPE
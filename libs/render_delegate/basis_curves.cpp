@@ -19,6 +19,7 @@
 #include <pxr/base/trace/trace.h>
 
 #include <constant_strings.h>
+#include <profile_utils.h>
 #include <shape_utils.h>
 
 #include "coord_sys.h"
@@ -81,7 +82,8 @@ VtValue Vec3fToVec2f(VtValue const &val) {
 }
 
 HdArnoldBasisCurves::HdArnoldBasisCurves(HdArnoldRenderDelegate* delegate, const SdfPath& id)
-    : HdArnoldRprim<HdBasisCurves>(str::curves, delegate, id), _interpolation(HdTokens->linear)
+    : HdArnoldRprim<HdBasisCurves>(str::curves, delegate, id), _interpolation(HdTokens->linear),
+      _curvesData(2, 1, _vertexCounts)
 {
 }
 
@@ -89,6 +91,7 @@ void HdArnoldBasisCurves::Sync(
     HdSceneDelegate* sceneDelegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits, const TfToken& reprToken)
 {
     AiProfileBlock("hydra_proc:sync:HdArnoldBasisCurves"); 
+    ArnoldUsdProfileScope profileScope("sync", "HdArnoldBasisCurves");
     TRACE_FUNCTION();
     if (!GetRenderDelegate()->CanUpdateScene())
         return;
@@ -179,6 +182,9 @@ void HdArnoldBasisCurves::Sync(
         } else {
             _vertexCounts = vertexCounts;
         }
+        // The remapping tables are rebuilt for the new topology the next time a primvar is remapped.
+        _curvesData.SetBasis(
+            _interpolation == HdTokens->linear ? 2 : 4, _interpolation == HdTokens->bezier ? 3 : 1);
         const auto numVertexCounts = vertexCounts.size();
         auto* numPointsArray = AiArrayAllocate(numVertexCounts, 1, AI_TYPE_UINT);
         if (numVertexCounts > 0) {
@@ -226,11 +232,6 @@ void HdArnoldBasisCurves::Sync(
         _visibilityFlags.ClearPrimvarFlags();
         _sidednessFlags.ClearPrimvarFlags();
         param.Interrupt();
-        const auto vstep = _interpolation == HdTokens->bezier ? 3 : 1;
-        const auto vmin = _interpolation == HdTokens->linear ? 2 : 4;
-
-        ArnoldUsdCurvesData curvesData(vmin, vstep, _vertexCounts);
-
         // For pinned curves, we might have to remap primvars differently #1240
         bool isPinned = (AiNodeGetStr(node, str::wrap_mode) == str::pinned);
 
@@ -246,7 +247,7 @@ void HdArnoldBasisCurves::Sync(
                     desc.interpolation == HdInterpolationVarying) &&
                     _interpolation != HdTokens->linear) {
                     auto value = desc.value;
-                    curvesData.RemapCurvesVertexPrimvar<float, double, GfHalf>(value);
+                    _curvesData.RemapCurvesVertexPrimvar<float, double, GfHalf>(value);
                     ArnoldUsdCurvesData::SetRadiusFromValue(node, value);
                 } else {
                     ArnoldUsdCurvesData::SetRadiusFromValue(node, desc.value);
@@ -300,7 +301,7 @@ void HdArnoldBasisCurves::Sync(
                     if (_interpolation == HdTokens->linear)
                         AiMsgWarning("%s : Orientations not supported on linear curves", AiNodeGetName(node));
                     else
-                        curvesData.SetOrientationFromValue(node, value);
+                        _curvesData.SetOrientationFromValue(node, value);
                 } else {
                     if (!desc.valueIndices.empty()) {
                         // This vertex-interpolated primvar is also indexed. Since we might have to remap them 
@@ -313,7 +314,7 @@ void HdArnoldBasisCurves::Sync(
                     // For pinned curves, vertex interpolation primvars shouldn't be remapped
                     if (_interpolation != HdTokens->linear && 
                         !(isPinned && desc.interpolation == HdInterpolationVertex)) {
-                        curvesData.RemapCurvesVertexPrimvar<
+                        _curvesData.RemapCurvesVertexPrimvar<
                             bool, VtUCharArray::value_type, unsigned int, int, float, GfVec2f, GfVec3f, GfVec4f,
                             std::string, TfToken, SdfAssetPath>(value);
                     }
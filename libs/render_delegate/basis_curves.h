@@ -31,6 +31,8 @@
 #include "rprim.h"
 #include "utils.h"
 
+#include <shape_utils.h>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdArnoldBasisCurves : public HdArnoldRprim<HdBasisCurves> {
@@ -66,6 +68,8 @@ protected:
     HdArnoldPrimvarMap _primvars; ///< Precomputed list of primvars.
     TfToken _interpolation;       ///< Interpolation of the curve.
     VtIntArray _vertexCounts;     ///< Stored vertex counts for curves.
+    /// Remapping data for vertex primvars, computed once per topology change.
+    ArnoldUsdCurvesData _curvesData;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
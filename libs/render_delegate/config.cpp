@@ -80,6 +80,10 @@ TF_DEFINE_ENV_SETTING(HDARNOLD_enable_progressive_render, true, "Enable progress
 
 TF_DEFINE_ENV_SETTING(HDARNOLD_progressive_min_AA_samples, -4, "Minimum AA samples for progressive rendering.");
 
+TF_DEFINE_ENV_SETTING(
+    HDARNOLD_progressive_adaptive_min_AA_samples, false,
+    "Adapt the minimum AA samples for progressive rendering to the time it takes to get the first pixels.");
+
 TF_DEFINE_ENV_SETTING(HDARNOLD_enable_adaptive_sampling, false, "Enable adaptive sapmling.");
 
 TF_DEFINE_ENV_SETTING(HDARNOLD_enable_gpu_rendering, false, "Enable gpu rendering.");
@@ -116,6 +120,14 @@ TF_DEFINE_ENV_SETTING(HDARNOLD_asset_searchpath, "", "Asset search path.");
 
 TF_DEFINE_ENV_SETTING(HDARNOLD_auto_generate_tx, true, "Auto-generate Textures to TX");
 
+TF_DEFINE_ENV_SETTING(
+    HDARNOLD_share_volumes, true,
+    "Volume prims reading the same grids from a vdb file share a single volume node through ginstances.");
+
+TF_DEFINE_ENV_SETTING(
+    HDARNOLD_dedup_materials, false,
+    "Materials with identical shading networks share the Arnold shaders of the first one translated.");
+
 #ifdef SUPPORT_ACCELERATED_VIEWPORT
 TF_DEFINE_ENV_SETTING(HDARNOLD_accelerated_viewport, false, "Enable accelerated viewport");
 #endif
@@ -156,6 +168,7 @@ HdArnoldConfig::HdArnoldConfig()
     GI_transmission_depth = std::max(0, TfGetEnvSetting(HDARNOLD_GI_transmission_depth));
     enable_progressive_render = TfGetEnvSetting(HDARNOLD_enable_progressive_render);
     progressive_min_AA_samples = TfGetEnvSetting(HDARNOLD_progressive_min_AA_samples);
+    progressive_adaptive_min_AA_samples = TfGetEnvSetting(HDARNOLD_progressive_adaptive_min_AA_samples);
     enable_adaptive_sampling = TfGetEnvSetting(HDARNOLD_enable_adaptive_sampling);
     enable_gpu_rendering = TfGetEnvSetting(HDARNOLD_enable_gpu_rendering);
     shutter_start = static_cast<float>(std::atof(TfGetEnvSetting(HDARNOLD_shutter_start).c_str()));
@@ -176,6 +189,8 @@ HdArnoldConfig::HdArnoldConfig()
 #endif
     osl_includepath = TfGetEnvSetting(HDARNOLD_osl_includepath);
     auto_generate_tx = TfGetEnvSetting(HDARNOLD_auto_generate_tx);
+    share_volumes = TfGetEnvSetting(HDARNOLD_share_volumes);
+    dedup_materials = TfGetEnvSetting(HDARNOLD_dedup_materials);
 
 #ifdef SUPPORT_ACCELERATED_VIEWPORT
     accelerated_viewport = TfGetEnvSetting(HDARNOLD_accelerated_viewport);
@@ -138,6 +138,10 @@ struct HdArnoldConfig {
     ///
     int progressive_min_AA_samples;
 
+    /// Use HDARNOLD_progressive_adaptive_min_AA_samples to set the value.
+    ///
+    bool progressive_adaptive_min_AA_samples; ///< Adapts the progressive min AA samples to the first pixel latency.
+
     /// Use HDARNOLD_enable_adaptive_sampling to set the value.
     ///
     bool enable_adaptive_sampling; ///< Enables adaptive sampling.
@@ -203,6 +207,14 @@ struct HdArnoldConfig {
     ///
     bool auto_generate_tx;
 
+    /// Use HDARNOLD_share_volumes to set the value.
+    ///
+    bool share_volumes; ///< Share the volume nodes loading the same vdb grids.
+
+    /// Use HDARNOLD_dedup_materials to set the value.
+    ///
+    bool dedup_materials; ///< Translate identical material networks only once.
+
     /// Use HDARNOLD_accelerated_viewport to set the value.
     ///
     bool accelerated_viewport = false;
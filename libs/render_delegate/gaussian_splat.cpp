@@ -20,6 +20,7 @@
 #if PXR_VERSION >= 2603
 
 #include <constant_strings.h>
+#include <shape_utils.h>
 
 #include "coord_sys.h"
 #include "node_graph.h"
@@ -57,59 +58,6 @@ HdDirtyBits HdArnoldGaussianSplat::GetInitialDirtyBitsMask() const
            HdArnoldShape::GetInitialDirtyBitsMask();
 }
 
-namespace {
-
-// Arnold's gaussianEvalSh expects the DC SH coefficient (index 0 per particle)
-// to be pre-stored as (raw_f_dc * C0 + 0.5), where C0 = 0.28209479177387814.
-// USD radiance:sphericalHarmonicsCoefficients stores raw SH coefficients; this
-// function applies the required transformation in-place on the gs_sh AtArray.
-static void _NormalizeShDcCoefficient(AtNode* node)
-{
-    AtArray* gsShArr  = AiNodeGetArray(node, str::gs_sh);
-    AtArray* ptsArr   = AiNodeGetArray(node, str::points);
-    if (!gsShArr || !ptsArr)
-        return;
-    const size_t nPts         = AiArrayGetNumElements(ptsArr);
-    const size_t nTotalCoeffs = AiArrayGetNumElements(gsShArr);
-    if (nPts == 0 || nTotalCoeffs % nPts != 0)
-        return;
-    const size_t nPerPoint = nTotalCoeffs / nPts;
-    // Valid SH coefficient counts per point: 1 (deg 0), 4, 9, 16 (deg 1-3)
-    if (nPerPoint != 1 && nPerPoint != 4 && nPerPoint != 9 && nPerPoint != 16)
-        return;
-    constexpr float C0 = 0.28209479177387814f;
-    for (size_t i = 0; i < nPts; ++i) {
-        const size_t dcIdx = i * nPerPoint;
-        const AtRGB  dc    = AiArrayGetRGB(gsShArr, dcIdx);
-        AiArraySetRGB(gsShArr, dcIdx,
-            AtRGB(dc.r * C0 + 0.5f, dc.g * C0 + 0.5f, dc.b * C0 + 0.5f));
-    }
-}
-
-// Set Arnold gs_rotation from a VtQuatfArray.
-// Arnold stores quaternions as [x, y, z, w] (4 floats per point).
-// USD GfQuatf stores GetReal()=w and GetImaginary()=(x,y,z).
-void _SetRotationFromQuatf(AtNode* node, const VtQuatfArray& orientations)
-{
-    const size_t n = orientations.size();
-    if (n == 0)
-        return;
-    AtArray* rotArray = AiArrayAllocate(n * 4, 1, AI_TYPE_FLOAT);
-    float* out = static_cast<float*>(AiArrayMap(rotArray));
-    for (size_t i = 0; i < n; ++i) {
-        const GfVec3f& imag = orientations[i].GetImaginary();
-        const float    w    = orientations[i].GetReal();
-        out[i * 4 + 0] = imag[0]; // x
-        out[i * 4 + 1] = imag[1]; // y
-        out[i * 4 + 2] = imag[2]; // z
-        out[i * 4 + 3] = w;       // w
-    }
-    AiArrayUnmap(rotArray);
-    AiNodeSetArray(node, str::gs_rotation, rotArray);
-}
-
-} // namespace
-
 void HdArnoldGaussianSplat::Sync(
     HdSceneDelegate* sceneDelegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits,
     const TfToken& reprToken)
@@ -146,12 +94,14 @@ void HdArnoldGaussianSplat::Sync(
         _sidednessFlags.ClearPrimvarFlags();
         param.Interrupt();
 
-        bool shCoeffsUpdated = false;
+        // The SH coefficients are set after the loop, once the amount of points
+        // is known, to normalize their DC term.
+        const VtValue* shCoeffs = nullptr;
         // Fallback for Houdini's ParticleField3DGaussianSplat export, which
         // stores the degree-0 splat color in primvars:displayColor instead of
         // radiance:sphericalHarmonicsCoefficients. Captured here and only used
         // after the loop if no radiance SH coefficients were provided.
-        VtVec3fArray displayColorFallback;
+        const VtValue* displayColorFallback = nullptr;
         for (auto& primvar : _primvars) {
             auto&         desc = primvar.second;
             if (!desc.NeedsUpdate())
@@ -161,104 +111,31 @@ void HdArnoldGaussianSplat::Sync(
 
             // --- positions → Arnold "points" ----------------------------------
             if (name == _tokens->positions) {
-                if (desc.value.IsHolding<VtVec3fArray>()) {
-                    const auto& v = desc.value.UncheckedGet<VtVec3fArray>();
-                    if (!v.empty())
-                        AiNodeSetArray(node, str::points,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_VECTOR, v.cdata()));
-                } else if (desc.value.IsHolding<VtVec3hArray>()) {
-                    const auto& vh = desc.value.UncheckedGet<VtVec3hArray>();
-                    if (!vh.empty()) {
-                        std::vector<GfVec3f> v(vh.size());
-                        for (size_t i = 0; i < vh.size(); ++i)
-                            v[i] = GfVec3f(vh[i]);
-                        AiNodeSetArray(node, str::points,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_VECTOR, v.data()));
-                    }
-                }
+                ArnoldUsdSetGaussianSplatVectors(node, str::points, desc.value);
                 continue;
             }
 
             // --- scales → Arnold "gs_scale" -----------------------------------
             if (name == _tokens->scales) {
-                if (desc.value.IsHolding<VtVec3fArray>()) {
-                    const auto& v = desc.value.UncheckedGet<VtVec3fArray>();
-                    if (!v.empty())
-                        AiNodeSetArray(node, str::gs_scale,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_VECTOR, v.cdata()));
-                } else if (desc.value.IsHolding<VtVec3hArray>()) {
-                    const auto& vh = desc.value.UncheckedGet<VtVec3hArray>();
-                    if (!vh.empty()) {
-                        std::vector<GfVec3f> v(vh.size());
-                        for (size_t i = 0; i < vh.size(); ++i)
-                            v[i] = GfVec3f(vh[i]);
-                        AiNodeSetArray(node, str::gs_scale,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_VECTOR, v.data()));
-                    }
-                }
+                ArnoldUsdSetGaussianSplatVectors(node, str::gs_scale, desc.value);
                 continue;
             }
 
             // --- orientations → Arnold "gs_rotation" ([x,y,z,w] per splat) ---
             if (name == _tokens->orientations) {
-                if (desc.value.IsHolding<VtQuatfArray>()) {
-                    _SetRotationFromQuatf(node, desc.value.UncheckedGet<VtQuatfArray>());
-                } else if (desc.value.IsHolding<VtQuathArray>()) {
-                    const auto& vh = desc.value.UncheckedGet<VtQuathArray>();
-                    if (!vh.empty()) {
-                        VtQuatfArray v(vh.size());
-                        for (size_t i = 0; i < vh.size(); ++i)
-                            v[i] = GfQuatf(vh[i]);
-                        _SetRotationFromQuatf(node, v);
-                    }
-                }
+                ArnoldUsdSetGaussianSplatRotations(node, desc.value);
                 continue;
             }
 
             // --- opacities → Arnold "gs_opacity" ------------------------------
             if (name == _tokens->opacities) {
-                if (desc.value.IsHolding<VtFloatArray>()) {
-                    const auto& v = desc.value.UncheckedGet<VtFloatArray>();
-                    if (!v.empty())
-                        AiNodeSetArray(node, str::gs_opacity,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_FLOAT, v.cdata()));
-                } else if (desc.value.IsHolding<VtHalfArray>()) {
-                    const auto& vh = desc.value.UncheckedGet<VtHalfArray>();
-                    if (!vh.empty()) {
-                        std::vector<float> v(vh.size());
-                        for (size_t i = 0; i < vh.size(); ++i)
-                            v[i] = static_cast<float>(vh[i]);
-                        AiNodeSetArray(node, str::gs_opacity,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_FLOAT, v.data()));
-                    }
-                }
+                ArnoldUsdSetGaussianSplatOpacities(node, desc.value);
                 continue;
             }
 
             // --- SH coefficients → Arnold "gs_sh" ----------------------------
-            // Note: USD stores raw SH coefficients. Arnold's gaussianEvalSh
-            // expects the DC term (index 0 per particle) pre-transformed as
-            // (raw_dc * C0 + 0.5). We apply this in _NormalizeShDcCoefficient
-            // after the full primvar loop once the point count is also known.
             if (name == _tokens->shCoeffs) {
-                if (desc.value.IsHolding<VtVec3fArray>()) {
-                    const auto& v = desc.value.UncheckedGet<VtVec3fArray>();
-                    if (!v.empty()) {
-                        AiNodeSetArray(node, str::gs_sh,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_RGB, v.cdata()));
-                        shCoeffsUpdated = true;
-                    }
-                } else if (desc.value.IsHolding<VtVec3hArray>()) {
-                    const auto& vh = desc.value.UncheckedGet<VtVec3hArray>();
-                    if (!vh.empty()) {
-                        std::vector<GfVec3f> v(vh.size());
-                        for (size_t i = 0; i < vh.size(); ++i)
-                            v[i] = GfVec3f(vh[i]);
-                        AiNodeSetArray(node, str::gs_sh,
-                            AiArrayConvert(v.size(), 1, AI_TYPE_RGB, v.data()));
-                        shCoeffsUpdated = true;
-                    }
-                }
+                shCoeffs = &desc.value;
                 continue;
             }
 
@@ -271,14 +148,7 @@ void HdArnoldGaussianSplat::Sync(
             // coefficients are present. displayColor already stores the final
             // DC color (raw_f_dc * C0 + 0.5), so it needs no normalization.
             if (name == _tokens->displayColor) {
-                if (desc.value.IsHolding<VtVec3fArray>()) {
-                    displayColorFallback = desc.value.UncheckedGet<VtVec3fArray>();
-                } else if (desc.value.IsHolding<VtVec3hArray>()) {
-                    const auto& vh = desc.value.UncheckedGet<VtVec3hArray>();
-                    displayColorFallback.resize(vh.size());
-                    for (size_t i = 0; i < vh.size(); ++i)
-                        displayColorFallback[i] = GfVec3f(vh[i]);
-                }
+                displayColorFallback = &desc.value;
                 continue;
             }
 
@@ -292,15 +162,12 @@ void HdArnoldGaussianSplat::Sync(
             }
         }
 
-        if (shCoeffsUpdated) {
-            _NormalizeShDcCoefficient(node);
-        } else if (!displayColorFallback.empty()) {
-            // No radiance SH coefficients were provided. Use displayColor as the
-            // degree-0 DC term (1 RGB per point). The values are already the final
-            // DC color (raw_f_dc * C0 + 0.5), so they are passed through directly.
-            AiNodeSetArray(node, str::gs_sh,
-                AiArrayConvert(displayColorFallback.size(), 1, AI_TYPE_RGB,
-                    displayColorFallback.cdata()));
+        // Radiance SH coefficients are raw values, their DC term is normalized as
+        // expected by Arnold. Otherwise, displayColor is used as the degree-0 DC term,
+        // its values are already the final DC color (raw_f_dc * C0 + 0.5).
+        if (shCoeffs == nullptr || !ArnoldUsdSetGaussianSplatShCoefficients(node, *shCoeffs, true)) {
+            if (displayColorFallback != nullptr)
+                ArnoldUsdSetGaussianSplatShCoefficients(node, *displayColorFallback, false);
         }
 
         UpdateVisibilityAndSidedness();
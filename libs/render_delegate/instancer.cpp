@@ -22,6 +22,7 @@
 #include <pxr/base/gf/rotation.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 #include <constant_strings.h>
+#include <profile_utils.h>
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -72,6 +73,25 @@ void _AccumulateSampleTimes(const HdArnoldSampledType<T1>& in, HdArnoldSampledTy
     }
 }
 
+/// Reset the per-instance data of an arnold instancer kept from a previous sync, so it
+/// can be filled again as if it was just created.
+void _ResetInstancerNode(AtNode* node)
+{
+    std::vector<AtString> userParams;
+    AtUserParamIterator* iter = AiNodeGetUserParamIterator(node);
+    while (!AiUserParamIteratorFinished(iter)) {
+        const AtUserParamEntry* paramEntry = AiUserParamIteratorGetNext(iter);
+        userParams.emplace_back(AiUserParamGetName(paramEntry));
+    }
+    AiUserParamIteratorDestroy(iter);
+    for (const auto& userParam : userParams) {
+        AiNodeResetParameter(node, userParam);
+    }
+    AiNodeResetParameter(node, str::instance_visibility);
+    AiNodeResetParameter(node, str::visibility);
+    AiNodeResetParameter(node, str::matte);
+}
+
 } // namespace
 
 HdArnoldInstancer::HdArnoldInstancer(
@@ -83,6 +103,7 @@ HdArnoldInstancer::HdArnoldInstancer(
 void HdArnoldInstancer::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits)
 {
     AiProfileBlock("hydra_proc:HdArnoldInstancer:Sync"); 
+    ArnoldUsdProfileScope profileScope("sync", "HdArnoldInstancer");
     TRACE_FUNCTION();
     if (!_delegate->CanUpdateScene())
         return;
@@ -565,7 +586,7 @@ int HdArnoldInstancer::ComputeSampleMatrixArrayRecursive(HdArnoldRenderDelegate
 }
 
 void HdArnoldInstancer::CreateArnoldInstancer(HdArnoldRenderDelegate* renderDelegate, 
-    const SdfPath& prototypeId, std::vector<AtNode *> &instancers)
+    const SdfPath& prototypeId, std::vector<AtNode *> &instancers, std::vector<AtNode *> *previousInstancers)
 {
     const SdfPath& instancerId = GetId();
 
@@ -600,7 +621,22 @@ void HdArnoldInstancer::CreateArnoldInstancer(HdArnoldRenderDelegate* renderDele
     } else {
         ss << AiNodeGetName(instancers.back()) << "_parent_" << instancerId;
     }
-    AtNode *instancerNode = renderDelegate->CreateArnoldNode(str::instancer, AtString(ss.str().c_str()));
+    const AtString instancerName(ss.str().c_str());
+    // The node names only depend on the nesting level and on the prototype, so when the previous
+    // chain has a node with the same name at this level we update it in place. This avoids
+    // destroying and recreating the instancers every time the instance transforms change.
+    AtNode *instancerNode = nullptr;
+    const size_t level = instancers.size();
+    if (previousInstancers != nullptr && level < previousInstancers->size()) {
+        AtNode *previousNode = (*previousInstancers)[level];
+        if (previousNode != nullptr && instancerName == AtString(AiNodeGetName(previousNode))) {
+            instancerNode = previousNode;
+            (*previousInstancers)[level] = nullptr;
+            _ResetInstancerNode(instancerNode);
+        }
+    }
+    if (instancerNode == nullptr)
+        instancerNode = renderDelegate->CreateArnoldNode(str::instancer, instancerName);
     instancers.push_back(instancerNode);
 
     if (AiNodeLookUpUserParameter(instancerNode, str::instance_inherit_xform) == nullptr)
@@ -669,7 +705,7 @@ void HdArnoldInstancer::CreateArnoldInstancer(HdArnoldRenderDelegate* renderDele
     if (ARCH_UNLIKELY(parentInstancer == nullptr)) {
         return;
     }
-    parentInstancer->CreateArnoldInstancer(renderDelegate, instancerId, instancers);
+    parentInstancer->CreateArnoldInstancer(renderDelegate, instancerId, instancers, previousInstancers);
     AiNodeSetByte(instancerNode, str::visibility, 0);
 }
 
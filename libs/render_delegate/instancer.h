@@ -60,10 +60,14 @@ public:
     /// Calculates the matrices for all instances for a given shape, including sampling multiple times.
     ///
     /// @param prototypeId ID of the instanced shape.
-    /// @param sampleArray Output struct to hold time sampled matrices.
+    /// @param instancers Output vector of arnold instancers, from the innermost to the outermost.
+    /// @param previousInstancers Optional arnold instancers created by a previous call. Nodes with
+    ///  a matching name are updated in place and set to nullptr in this vector, the remaining ones
+    ///  have to be destroyed by the caller.
     HDARNOLD_API
     void CreateArnoldInstancer(HdArnoldRenderDelegate* renderDelegate, 
-        const SdfPath& prototypeId, std::vector<AtNode *> &instancers);
+        const SdfPath& prototypeId, std::vector<AtNode *> &instancers,
+        std::vector<AtNode *> *previousInstancers = nullptr);
 
 
     HDARNOLD_API
@@ -33,16 +33,19 @@
 #include "mesh.h"
 #include "instancer.h"
 #include <pxr/base/trace/trace.h>
+#include <pxr/imaging/hd/renderIndex.h>
 
 #include <pxr/usd/usdLux/tokens.h>
 #include <pxr/usd/usdLux/blackbody.h>
 
 #include <pxr/usd/sdf/assetPath.h>
 
+#include <algorithm>
 #include <vector>
 
 #include <common_utils.h>
 #include <constant_strings.h>
+#include <profile_utils.h>
 
 #include "node_graph.h"
 #include "utils.h"
@@ -77,6 +80,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (GeometryLight)
     ((filtersArray, "filters:i"))
     ((emptyLink, "__arnold_empty_link__"))
+    ((visibility, "__arnold_visibility__"))
 );
 // clang-format on
 
@@ -406,30 +410,43 @@ auto rectLightSync = [](AtNode* light, AtNode** filter, const AtNodeEntry* nentr
     readUserData(light, id, sceneDelegate, renderDelegate);
 };
 
+/// Returns true if mesh lights are created by the scene index filter meshLightResolvingSIP.cpp.
+bool usesMeshLightSceneIndex()
+{
+#ifdef ENABLE_SCENE_INDEX
+    return HdRenderIndex::IsSceneIndexEmulationEnabled();
+#else
+    return false;
+#endif
+}
+
+/// Returns the path of the geometry emitting light for a mesh light.
+///
+/// @param sceneDelegate Pointer to the Scene Delegate.
+/// @param id Path to the Hydra light.
+/// @return Path to the geometry, empty if none was found.
+SdfPath getGeometryLightPath(HdSceneDelegate* sceneDelegate, const SdfPath& id)
+{
+    // With the scene index filter meshLightResolvingSIP.cpp, we create an hydra mesh light prim just under the mesh
+    if (usesMeshLightSceneIndex())
+        return id.GetParentPath();
+    VtValue geomValue = sceneDelegate->Get(id, str::t_geometry);
+    return geomValue.IsHolding<SdfPath>() ? geomValue.UncheckedGet<SdfPath>() : SdfPath();
+}
+
 auto geometryLightSync = [](AtNode* light, AtNode** filter, const AtNodeEntry* nentry, const SdfPath& id,
                             HdSceneDelegate* sceneDelegate, HdArnoldRenderDelegate* renderDelegate)
 {
     TF_UNUSED(filter);
-    VtValue geomValue = sceneDelegate->Get(id, str::t_geometry);
-    if (geomValue.IsHolding<SdfPath>()) {
-        SdfPath geomPath = geomValue.UncheckedGet<SdfPath>();
-        //const HdArnoldMesh *hdMesh = dynamic_cast<const HdArnoldMesh*>(sceneDelegate->GetRenderIndex().GetRprim(geomPath));
+    const SdfPath geomPath = getGeometryLightPath(sceneDelegate, id);
+    if (!geomPath.IsEmpty()) {
+        // It is possible that the mesh node hasn't been created yet, the light depends on the
+        // geometry prim and will be synced again when it is created (see HdArnoldGenericLight::Sync)
         AtNode *mesh = renderDelegate->LookupNode(geomPath.GetText());
         if (mesh != nullptr && !AiNodeIs(mesh, str::polymesh))
             mesh = nullptr;
         AiNodeSetPtr(light, str::mesh,(void*) mesh);
     }
-#ifdef ENABLE_SCENE_INDEX
-    {
-        // With the scene index filter meshLightResolvingSIP.cpp, we create an hydra mesh light prim just under the mesh
-        // Since we know that the mesh is the parent of the light, we try to get the arnold node there
-        // It is possible that the mesh node hasn't been created yet
-        AtNode* mesh = renderDelegate->LookupNode(id.GetParentPath().GetText());
-        if (mesh != nullptr && !AiNodeIs(mesh, str::polymesh))
-            mesh = nullptr;
-        AiNodeSetPtr(light, str::mesh, (void*)mesh);
-    }
-#endif
     iterateParams(light, nentry, id, sceneDelegate, renderDelegate, meshParams);
     readUserData(light, id, sceneDelegate, renderDelegate);
 #ifdef ENABLE_SCENE_INDEX
@@ -508,6 +525,79 @@ auto domeLightSync = [](AtNode* light, AtNode** filter, const AtNodeEntry* nentr
     readUserData(light, id, sceneDelegate, renderDelegate);
 };
 
+/// Light parameters read during the last sync, in a fixed order for each light type.
+using LightParamSnapshot = std::vector<std::pair<TfToken, VtValue>>;
+
+/// Returns the light parameters to snapshot for a given Arnold light type.
+///
+/// This includes all the parameters read by the light specific sync functions, as well as
+/// the parameters driving the light color and filters.
+///
+/// @param lightType Type of the Arnold light.
+/// @return List of the parameter names.
+const std::vector<TfToken>& getSnapshotParams(const AtString& lightType)
+{
+    auto buildParams = [](std::initializer_list<const std::vector<ParamDesc>*> tables,
+                          std::initializer_list<TfToken> extraParams) -> std::vector<TfToken> {
+        std::vector<TfToken> params;
+        auto addParam = [&](const TfToken& param) {
+            if (std::find(params.begin(), params.end(), param) == params.end())
+                params.push_back(param);
+        };
+        for (const auto& param : genericParams)
+            addParam(param.hdName);
+        for (const auto* table : tables) {
+            for (const auto& param : *table)
+                addParam(param.hdName);
+        }
+        for (const auto& param : {UsdLuxTokens->inputsEnableColorTemperature, UsdLuxTokens->inputsColorTemperature,
+                                  UsdLuxTokens->inputsTextureFile, _tokens->filters, TfToken("primvars:arnold:shaders")})
+            addParam(param);
+        for (const auto& param : extraParams)
+            addParam(param);
+        return params;
+    };
+    // Point lights can be converted to spot or photometric lights depending on their parameters
+    static const std::vector<TfToken> pointLightParams = buildParams(
+        {&pointParams, &spotParams, &photometricParams},
+        {UsdLuxTokens->treatAsPoint, _tokens->barndoorbottom, _tokens->barndoorbottomedge, _tokens->barndoorleft,
+         _tokens->barndoorleftedge, _tokens->barndoorright, _tokens->barndoorrightedge, _tokens->barndoortop,
+         _tokens->barndoortopedge});
+    static const std::vector<TfToken> distantLightParams = buildParams({&distantParams}, {});
+    static const std::vector<TfToken> diskLightParams = buildParams({&diskParams}, {});
+    static const std::vector<TfToken> quadLightParams =
+        buildParams({&quadParams}, {UsdLuxTokens->inputsWidth, UsdLuxTokens->inputsHeight});
+    static const std::vector<TfToken> cylinderLightParams =
+        buildParams({&cylinderParams}, {UsdLuxTokens->inputsLength});
+    static const std::vector<TfToken> skydomeLightParams = buildParams({}, {UsdLuxTokens->inputsTextureFormat});
+    static const std::vector<TfToken> emptyParams;
+
+    if (lightType == str::point_light || lightType == str::spot_light || lightType == str::photometric_light)
+        return pointLightParams;
+    if (lightType == str::distant_light)
+        return distantLightParams;
+    if (lightType == str::disk_light)
+        return diskLightParams;
+    if (lightType == str::quad_light)
+        return quadLightParams;
+    if (lightType == str::cylinder_light)
+        return cylinderLightParams;
+    if (lightType == str::skydome_light)
+        return skydomeLightParams;
+    // Mesh lights also read the primvars of their geometry, they are always fully synced
+    return emptyParams;
+}
+
+/// Returns true if a generic parameter can be set on its own, without syncing the other
+/// parameters of the light.
+///
+/// The color is modulated by the color temperature and textures, and normalize is reset
+/// by some of the light specific sync functions.
+bool isIndependentParam(const AtString& arnoldName)
+{
+    return arnoldName != str::color && arnoldName != str::normalize;
+}
+
 /// Utility class to translate Hydra lights for th Render Delegate.
 class HdArnoldGenericLight : public HdLight {
 public:
@@ -553,7 +643,41 @@ public:
     /// @return The arnold light node stored.
     AtNode* GetLightNode() const;
 
+    /// Returns the sync statistics of the light.
+    ///
+    /// @return Counters of the light syncs.
+    const HdArnoldLightSyncStats& GetSyncStats() const { return _syncStats; }
+
 private:
+    /// Reads the current values of the light parameters.
+    ///
+    /// @param sceneDelegate Pointer to the Scene Delegate.
+    /// @param lightType Type of the Arnold light.
+    /// @param snapshot Output snapshot, left empty if the light type can't be snapshotted.
+    void _ReadParamSnapshot(HdSceneDelegate* sceneDelegate, const AtString& lightType, LightParamSnapshot& snapshot) const;
+
+    /// Applies only the parameters that changed since the last sync, when possible.
+    ///
+    /// Returns false if the light requires a full sync, which happens if parameters depending
+    /// on each other changed, or if the light uses node graphs or instancers.
+    ///
+    /// @param sceneDelegate Pointer to the Scene Delegate.
+    /// @param param Pointer to the render param, interrupted only if a parameter changed.
+    /// @param snapshot Current values of the light parameters.
+    /// @return True if the light parameters are up to date.
+    bool _SyncChangedParams(HdSceneDelegate* sceneDelegate, HdArnoldRenderParam* param, const LightParamSnapshot& snapshot);
+
+    /// Returns the sum of the light shader versions of the node graphs used by the light
+    /// during its last sync.
+    ///
+    /// @param renderIndex Render Index used to look up the node graphs.
+    /// @return Sum of the light shader versions.
+    unsigned int _ComputeLightShaderVersion(HdRenderIndex& renderIndex) const;
+
+    /// Replaces the Arnold light by a new node of the same type, so that Arnold
+    /// rebuilds its importance tables.
+    void _RecreateLightNode();
+
     SyncParams _syncParams;            ///< Function object to sync light parameters.
     HdArnoldRenderDelegate* _delegate; ///< Pointer to the Render Delegate.
     AtNode* _light = nullptr;          ///< Pointer to the Arnold Light.
@@ -564,6 +688,10 @@ private:
     bool _supportsTexture = false;     ///< Value indicating texture support.
     bool _hasNodeGraphs = false;
     std::vector<AtNode*> _instancers;        ///< Pointer to the Arnold instancer and its parent instancers if any.
+    SdfPathVector _lightShaderPaths;         ///< Node graphs used for the light color and filters.
+    unsigned int _lightShaderVersion = 0;    ///< Light shader version of the node graphs at the last sync.
+    LightParamSnapshot _paramSnapshot;       ///< Light parameters applied during the last sync.
+    HdArnoldLightSyncStats _syncStats;       ///< Counters of the light syncs.
 };
 
 HdArnoldGenericLight::HdArnoldGenericLight(
@@ -604,6 +732,7 @@ HdArnoldGenericLight::~HdArnoldGenericLight()
 void HdArnoldGenericLight::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits)
 {
     AiProfileBlock("hydra_proc:HdArnoldGenericLight:Sync"); 
+    ArnoldUsdProfileScope profileScope("sync", "HdArnoldGenericLight");
     TRACE_FUNCTION();
 
     if (!_delegate->CanUpdateScene())
@@ -615,9 +744,26 @@ void HdArnoldGenericLight::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* r
     const AtNodeEntry* nentry = _light ? AiNodeGetNodeEntry(_light) : nullptr;
     const AtString lightType = nentry ? AiNodeEntryGetNameAtString(nentry) : AtString();
 
-    // TODO find why we're not getting the proper dirtyBits for mesh lights, even though the 
-    // adapter is returning HdLight::AllDirty
-    if ((*dirtyBits & HdLight::DirtyParams) || lightType == str::mesh_light || _light == nullptr) {
+    // Most edits on light rigs only modify a few parameters, like the intensity. When possible,
+    // we only set the parameters that changed, and we don't interrupt the render if none did.
+    // TODO find why we're not getting the proper dirtyBits for mesh lights without the scene index,
+    // even though the adapter is returning HdLight::AllDirty. The scene index forwards the edits of
+    // the mesh to the light, so mesh lights are only synced when they are dirty in that case.
+    const bool forceSync = lightType == str::mesh_light && !usesMeshLightSceneIndex();
+    bool syncParams = (*dirtyBits & HdLight::DirtyParams) || forceSync || _light == nullptr;
+    LightParamSnapshot paramSnapshot;
+    if (syncParams) {
+        _syncStats.syncs++;
+        if (_light != nullptr) {
+            _ReadParamSnapshot(sceneDelegate, lightType, paramSnapshot);
+            if (_SyncChangedParams(sceneDelegate, param, paramSnapshot))
+                syncParams = false;
+        }
+    }
+
+    if (syncParams) {
+        _syncStats.fullSyncs++;
+        _syncStats.interrupts++;
         param->Interrupt();
 
         // If the params have changed, we need to see if any of the shaping parameters were applied to the
@@ -649,6 +795,16 @@ void HdArnoldGenericLight::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* r
                 }
             }
         }
+        // Arnold doesn't see the changes of the shaders connected to a light, which matters
+        // for lights caching importance tables from their color. Instead of flushing the
+        // caches of the whole universe, only the lights using the modified node graphs are
+        // replaced by a new node.
+        const unsigned int lightShaderVersion = _ComputeLightShaderVersion(sceneDelegate->GetRenderIndex());
+        if (lightShaderVersion != _lightShaderVersion &&
+            (lightType == str::skydome_light || lightType == str::quad_light || lightType == str::mesh_light)) {
+            _RecreateLightNode();
+        }
+
         // Clear any incoming connections on parameters that can be driven by a node
         // graph (color, filters). The subsequent value writes and shader/texture
         // links below depend on starting from a disconnected state, and Arnold's
@@ -709,9 +865,13 @@ void HdArnoldGenericLight::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* r
             }
         }
 
+        SdfPathVector lightShaderPaths;
+        if (!lightShaderPath.IsEmpty())
+            lightShaderPaths.push_back(lightShaderPath);
         const auto filtersValue = sceneDelegate->GetLightParamValue(id, _tokens->filters);
         if (filtersValue.IsHolding<SdfPathVector>()) {
             const auto& filterPaths = filtersValue.UncheckedGet<SdfPathVector>();
+            lightShaderPaths.insert(lightShaderPaths.end(), filterPaths.begin(), filterPaths.end());
             std::vector<AtNode*> filters;
             filters.reserve(filterPaths.size());
             for (const auto& filterPath : filterPaths) {
@@ -777,9 +937,11 @@ void HdArnoldGenericLight::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* r
         }
 
 
+        // Light filters given through the filters relationship are node graphs as well,
+        // the light needs to be updated when they change.
         HdArnoldRenderDelegate::PathSetWithDirtyBits pathSet;
-        if (!lightShaderPath.IsEmpty())
-            pathSet.insert({lightShaderPath, HdLight::DirtyParams});
+        for (const auto& lightShaderGraph : lightShaderPaths)
+            pathSet.insert({lightShaderGraph, HdLight::DirtyParams});
 
         // Instanced lights are Sprims, and Hydra does not re-sync them when only their Point
         // Instancer animates - the instancer's prototype chain has no Rprim to carry the dirty
@@ -790,12 +952,26 @@ void HdArnoldGenericLight::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* r
         if (!instancerId.IsEmpty())
             pathSet.insert({instancerId, HdLight::DirtyParams});
 
+        // Mesh lights point to the Arnold node of their geometry, which can be created or
+        // destroyed after the light is synced. The render delegate dirties the light in
+        // that case, instead of syncing mesh lights continuously.
+        if (AiNodeIs(_light, str::mesh_light)) {
+            const SdfPath geomPath = getGeometryLightPath(sceneDelegate, id);
+            if (!geomPath.IsEmpty())
+                pathSet.insert({geomPath, HdLight::DirtyParams});
+        }
+
         // If we previously had node graph connected, we need to call TrackDependencies
         // even if our list is empty. This is needed to clear the previous dependencies
         if (_hasNodeGraphs || !pathSet.empty()) {
             _delegate->TrackDependencies(id, pathSet);
         }
         _hasNodeGraphs = !pathSet.empty();
+        _lightShaderPaths = std::move(lightShaderPaths);
+        _lightShaderVersion = _ComputeLightShaderVersion(sceneDelegate->GetRenderIndex());
+        // The snapshot was read before the light type is known when the node is first created,
+        // it will just not match during the next sync
+        _paramSnapshot = std::move(paramSnapshot);
     }
 
     if (*dirtyBits & HdLight::DirtyTransform) {
@@ -825,6 +1001,100 @@ void HdArnoldGenericLight::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* r
     *dirtyBits = HdLight::Clean;
 }
 
+void HdArnoldGenericLight::_ReadParamSnapshot(
+    HdSceneDelegate* sceneDelegate, const AtString& lightType, LightParamSnapshot& snapshot) const
+{
+    const auto& params = getSnapshotParams(lightType);
+    if (params.empty())
+        return;
+    const auto& id = GetId();
+    const auto primvars = sceneDelegate->GetPrimvarDescriptors(id, HdInterpolation::HdInterpolationConstant);
+    snapshot.reserve(params.size() + primvars.size() + 1);
+    for (const auto& paramName : params)
+        snapshot.emplace_back(paramName, sceneDelegate->GetLightParamValue(id, paramName));
+    for (const auto& primvar : primvars) {
+#if PXR_VERSION < 2111
+        const TfToken primvarName{TfStringPrintf("primvars:%s", primvar.name.GetText())};
+#else
+        const TfToken& primvarName = primvar.name;
+#endif
+        snapshot.emplace_back(primvarName, sceneDelegate->Get(id, primvarName));
+    }
+    snapshot.emplace_back(_tokens->visibility, VtValue(sceneDelegate->GetVisible(id)));
+}
+
+bool HdArnoldGenericLight::_SyncChangedParams(
+    HdSceneDelegate* sceneDelegate, HdArnoldRenderParam* param, const LightParamSnapshot& snapshot)
+{
+    // Node graphs and instancers can dirty the light without any change in its parameters
+    if (snapshot.empty() || snapshot.size() != _paramSnapshot.size() || !_lightShaderPaths.empty() ||
+        !_instancers.empty() || !sceneDelegate->GetInstancerId(GetId()).IsEmpty())
+        return false;
+
+    // Changed generic parameters, with their index in the snapshot
+    std::vector<std::pair<const ParamDesc*, size_t>> changedParams;
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        if (snapshot[i].first != _paramSnapshot[i].first)
+            return false;
+        if (snapshot[i].second == _paramSnapshot[i].second)
+            continue;
+        const auto paramIt = std::find_if(genericParams.begin(), genericParams.end(),
+            [&](const ParamDesc& desc) { return desc.hdName == snapshot[i].first; });
+        if (paramIt == genericParams.end() || !isIndependentParam(paramIt->arnoldName))
+            return false;
+        changedParams.emplace_back(&(*paramIt), i);
+    }
+
+    if (changedParams.empty()) {
+        _syncStats.skippedSyncs++;
+        return true;
+    }
+    _syncStats.partialSyncs++;
+    _syncStats.interrupts++;
+    param->Interrupt();
+    const auto* nentry = AiNodeGetNodeEntry(_light);
+    for (const auto& changedParam : changedParams) {
+        const AtString& arnoldName = changedParam.first->arnoldName;
+        const auto* pentry = AiNodeEntryLookUpParameter(nentry, arnoldName);
+        if (pentry == nullptr)
+            continue;
+        const VtValue& value = snapshot[changedParam.second].second;
+        if (value.IsEmpty()) {
+            AiNodeResetParameter(_light, arnoldName);
+        } else {
+            HdArnoldSetParameter(_light, pentry, value, _delegate);
+        }
+        _syncStats.paramWrites++;
+    }
+    _paramSnapshot = snapshot;
+    return true;
+}
+
+unsigned int HdArnoldGenericLight::_ComputeLightShaderVersion(HdRenderIndex& renderIndex) const
+{
+    unsigned int version = 0;
+    for (const auto& lightShaderPath : _lightShaderPaths) {
+        const auto* nodeGraph = HdArnoldNodeGraph::GetNodeGraph(renderIndex, lightShaderPath, _delegate);
+        if (nodeGraph != nullptr)
+            version += nodeGraph->GetLightShaderVersion();
+    }
+    return version;
+}
+
+void HdArnoldGenericLight::_RecreateLightNode()
+{
+    // Reset the previous light name so that we can create a new one with that same name
+    AtNode* oldLight = _light;
+    AiNodeSetStr(oldLight, str::name, AtString());
+    _light = _delegate->CreateArnoldNode(AiNodeEntryGetNameAtString(AiNodeGetNodeEntry(oldLight)), AtString(GetId().GetText()));
+    // All the other parameters are set again by the sync, but the transform is only
+    // set when it's dirty
+    AiNodeSetArray(_light, str::matrix, AiArrayCopy(AiNodeGetArray(oldLight, str::matrix)));
+    if (!_delegate->IsBatchContext())
+        AiNodeReplace(oldLight, _light, false);
+    _delegate->DestroyArnoldNode(oldLight);
+}
+
 void HdArnoldGenericLight::SetupTexture(const VtValue& value)
 {
     
@@ -919,6 +1189,13 @@ AtNode* GetLightNode(const HdLight* light)
     return static_cast<const HdArnoldGenericLight*>(light)->GetLightNode();
 }
 
+const HdArnoldLightSyncStats* GetLightSyncStats(const HdLight* light)
+{
+    if (Ai_unlikely(light == nullptr))
+        return nullptr;
+    return &static_cast<const HdArnoldGenericLight*>(light)->GetSyncStats();
+}
+
 SdfPath ComputeLightShaders(HdSceneDelegate* sceneDelegate, HdArnoldRenderDelegate *renderDelegate, const SdfPath &id, const TfToken &attr, AtNode *light )
 {
     // Get the value of the parameter on the light
@@ -45,6 +45,16 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// Counters of the syncs of a light, used for benchmarking light edits.
+struct HdArnoldLightSyncStats {
+    size_t syncs = 0;        ///< Syncs with dirty parameters.
+    size_t fullSyncs = 0;    ///< Syncs converting all the parameters of the light.
+    size_t partialSyncs = 0; ///< Syncs setting only the parameters that changed.
+    size_t skippedSyncs = 0; ///< Syncs where no parameter changed.
+    size_t paramWrites = 0;  ///< Parameters set by partial syncs.
+    size_t interrupts = 0;   ///< Render interruptions caused by parameter changes.
+};
+
 namespace HdArnoldLight {
 
 /// Returns an instance of HdArnoldLight for handling point lights.
@@ -104,6 +114,13 @@ HdLight* CreateGeometryLight(HdArnoldRenderDelegate* renderDelegate, const SdfPa
 /// @return Pointer to the Arnold Light, can be nullptr.
 AtNode* GetLightNode(const HdLight* light);
 
+/// Returns the sync statistics of any HdLight.
+///
+/// @param light Pointer to the HdLight.
+/// @return Pointer to the sync statistics, can be nullptr.
+HDARNOLD_API
+const HdArnoldLightSyncStats* GetLightSyncStats(const HdLight* light);
+
 SdfPath ComputeLightShaders(HdSceneDelegate* sceneDelegate, HdArnoldRenderDelegate *renderDelegate, const SdfPath &id, const TfToken &attr, AtNode *light);
 
 } // namespace HdArnoldLight
@@ -38,6 +38,7 @@
 #include <pxr/imaging/pxOsd/tokens.h>
 
 #include <constant_strings.h>
+#include <profile_utils.h>
 #include <shape_utils.h>
 
 #include "hdarnold.h"
@@ -207,6 +208,7 @@ void HdArnoldMesh::Sync(
     HdSceneDelegate* sceneDelegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits, const TfToken& reprToken)
 {
     AiProfileBlock("hydra_proc:HdArnoldMesh:Sync"); 
+    ArnoldUsdProfileScope profileScope("sync", "HdArnoldMesh");
     TRACE_FUNCTION();
     if (!GetRenderDelegate()->CanUpdateScene())
         return;
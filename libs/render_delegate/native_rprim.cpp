@@ -87,19 +87,39 @@ void HdArnoldNativeRprim::Sync(
     syncBuiltinParameters = syncBuiltinParameters || (*dirtyBits & HdChangeTracker::DirtyPrimvar);
  #endif   
     if (syncBuiltinParameters && Ai_likely(_paramList != nullptr)) {
-        param.Interrupt();
         VtValue val = GetArnoldAttributes();
         if (val.IsHolding<ArnoldUsdParamValueList>()) {
-            const auto* nodeEntry = AiNodeGetNodeEntry(GetArnoldNode());
-            for (const auto& param : val.UncheckedGet<ArnoldUsdParamValueList>()) {
-                HdArnoldSetParameter(
-                    GetArnoldNode(), AiNodeEntryLookUpParameter(nodeEntry, param.first), param.second,
-                    GetRenderDelegate());
-                if (param.first == str::t_visibility) {
-                    int visibilityValue = (int)AiNodeGetByte(GetArnoldNode(), str::visibility);
-                    _visibilityFlags.SetPrimvarFlag(~visibilityValue, false);
+            AtNode* node = GetArnoldNode();
+            const auto* nodeEntry = AiNodeGetNodeEntry(node);
+            // The parameters are all dirtied by a single bit, so we compare them with the values applied
+            // during the previous sync, and only set the ones that changed. Native shapes can hold large
+            // arrays (polymesh, nurbs, ...), and an unrelated parameter tweak shouldn't set them again.
+            AppliedParams appliedParams;
+            appliedParams.reserve(val.UncheckedGet<ArnoldUsdParamValueList>().size());
+            for (const auto& paramValue : val.UncheckedGet<ArnoldUsdParamValueList>()) {
+                const auto applied = _appliedParams.find(paramValue.first);
+                // The visibility is always set, since the primvar flags are cleared with the visibility bits
+                const bool isVisibility = paramValue.first == str::t_visibility;
+                if (isVisibility || applied == _appliedParams.end() || applied->second != paramValue.second) {
+                    param.Interrupt();
+                    HdArnoldSetParameter(
+                        node, AiNodeEntryLookUpParameter(nodeEntry, paramValue.first), paramValue.second,
+                        GetRenderDelegate());
+                    if (isVisibility) {
+                        int visibilityValue = (int)AiNodeGetByte(node, str::visibility);
+                        _visibilityFlags.SetPrimvarFlag(~visibilityValue, false);
+                    }
+                }
+                appliedParams.emplace(paramValue.first, paramValue.second);
+            }
+            // Parameters that are not authored anymore go back to their default value
+            for (const auto& applied : _appliedParams) {
+                if (applied.first != str::visibility && appliedParams.find(applied.first) == appliedParams.end()) {
+                    param.Interrupt();
+                    AiNodeResetParameter(node, applied.first);
                 }
             }
+            _appliedParams.swap(appliedParams);
         }
     }
 
@@ -170,8 +190,6 @@ void HdArnoldNativeRprim::Sync(
     *dirtyBits = HdChangeTracker::Clean;
 }
 
-// TODO conversion between HdDirtyBits and ArnoldUsdRprimBitsParams
-
 HdDirtyBits HdArnoldNativeRprim::GetInitialDirtyBitsMask() const
 {
     return HdChangeTracker::Clean | HdChangeTracker::InitRepr | HdChangeTracker::DirtyTransform |
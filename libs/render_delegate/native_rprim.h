@@ -28,6 +28,8 @@
 #include "render_delegate.h"
 #include "rprim.h"
 
+#include <unordered_map>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdArnoldNativeRprim : public HdArnoldRprim<HdRprim> {
@@ -50,6 +52,9 @@ public:
 private:
     /// List of parameters to query from the Hydra Primitive.
     const HdArnoldRenderDelegate::NativeRprimParamList* _paramList = nullptr;
+    using AppliedParams = std::unordered_map<AtString, VtValue, AtStringHash>;
+    /// Parameter values set on the Arnold node during the last sync.
+    AppliedParams _appliedParams;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
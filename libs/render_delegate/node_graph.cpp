@@ -37,6 +37,7 @@
 #include <pxr/usdImaging/usdImaging/tokens.h>
 
 #include <constant_strings.h>
+#include "config.h"
 #include "hdarnold.h"
 #include "utils.h"
 
@@ -45,6 +46,7 @@
 #include <iostream>
 #include <unordered_map>
 #include <materials_utils.h>
+#include <profile_utils.h>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -77,6 +79,142 @@ inline void AppendPathLeafSuffix(SdfPath& path, const std::string& suffix)
     path = path.GetParentPath().AppendChild(TfToken(path.GetName() + suffix));
 }
 
+// Compare a material network with the one previously translated for the same terminal.
+// Returns false if its topology changed (shaders added, removed, reordered or with a
+// different type), otherwise fills changedShaders with the shaders that need to be
+// translated again : the ones with different parameter values or input connections,
+// and the ones connected to them, since their translation can read the parameters of
+// the shaders they're connected to (see MaterialReader::GetShaderInput).
+inline bool DiffMaterialNetwork(const HdMaterialNetwork& previous, const HdMaterialNetwork& current,
+    bool allowConnectionChanges, std::unordered_set<SdfPath, TfHash>& changedShaders)
+{
+    if (previous.nodes.size() != current.nodes.size() || previous.primvars != current.primvars)
+        return false;
+    for (size_t i = 0; i < current.nodes.size(); ++i) {
+        const HdMaterialNode& previousNode = previous.nodes[i];
+        const HdMaterialNode& currentNode = current.nodes[i];
+        if (previousNode.path != currentNode.path || previousNode.identifier != currentNode.identifier)
+            return false;
+        if (previousNode.parameters != currentNode.parameters)
+            changedShaders.insert(currentNode.path);
+    }
+    if (previous.relationships != current.relationships) {
+        if (!allowConnectionChanges)
+            return false;
+        auto markChangedConnections = [&](const std::vector<HdMaterialRelationship>& relationships,
+                                          const std::vector<HdMaterialRelationship>& otherRelationships) {
+            for (const auto& relationship : relationships) {
+                if (std::find(otherRelationships.begin(), otherRelationships.end(), relationship) ==
+                    otherRelationships.end())
+                    changedShaders.insert(relationship.outputId);
+            }
+        };
+        markChangedConnections(current.relationships, previous.relationships);
+        markChangedConnections(previous.relationships, current.relationships);
+    }
+    if (!changedShaders.empty()) {
+        for (const auto& relationship : current.relationships) {
+            if (changedShaders.count(relationship.inputId) != 0)
+                changedShaders.insert(relationship.outputId);
+        }
+    }
+    return true;
+}
+
+// Only the networks assigned to rprims can be shared between identical materials,
+// the other terminals (light filters, imagers, ...) are looked up by the prims using them.
+inline bool CanShareMaterialNetworkMap(const HdMaterialNetworkMap& materialNetworkMap)
+{
+    if (materialNetworkMap.map.empty())
+        return false;
+    for (const auto& tokenAndMaterialNetwork : materialNetworkMap.map) {
+        const TfToken& terminalType = tokenAndMaterialNetwork.first;
+        if (terminalType != HdMaterialTerminalTokens->surface &&
+            terminalType != HdMaterialTerminalTokens->displacement &&
+            terminalType != HdMaterialTerminalTokens->volume)
+            return false;
+    }
+    return true;
+}
+
+// Hash the contents of a material network map : shader types, parameter values, connections
+// and terminals. Shader paths are made relative to the material, so that copies of the same
+// network published under different materials get the same hash.
+inline size_t HashMaterialNetworkMap(const HdMaterialNetworkMap& materialNetworkMap, const SdfPath& materialPath)
+{
+    auto relativePath = [&](SdfPath path) -> SdfPath {
+        EnsurePathHasMaterialPrefix(path, materialPath);
+        return path.MakeRelativePath(materialPath);
+    };
+    size_t hash = materialNetworkMap.map.size();
+    for (const auto& terminal : materialNetworkMap.terminals)
+        hash = TfHash::Combine(hash, relativePath(terminal));
+    for (const auto& tokenAndMaterialNetwork : materialNetworkMap.map) {
+        const HdMaterialNetwork& network = tokenAndMaterialNetwork.second;
+        hash = TfHash::Combine(hash, tokenAndMaterialNetwork.first, network.primvars);
+        for (const auto& node : network.nodes) {
+            hash = TfHash::Combine(hash, relativePath(node.path), node.identifier);
+            for (const auto& parameter : node.parameters)
+                hash = TfHash::Combine(hash, parameter.first, parameter.second);
+        }
+        for (const auto& relationship : network.relationships) {
+            hash = TfHash::Combine(hash, relativePath(relationship.inputId), relationship.inputName,
+                relativePath(relationship.outputId), relationship.outputName);
+        }
+    }
+    // 0 is reserved for node graphs that aren't registered
+    return hash == 0 ? 1 : hash;
+}
+
+// Compare the contents of two material network maps, with shader paths relative to their material.
+// Equal hashes don't guarantee that the networks are identical.
+inline bool AreMaterialNetworkMapsEqual(
+    const HdMaterialNetworkMap& networkMap, const SdfPath& materialPath, const HdMaterialNetworkMap& otherNetworkMap,
+    const SdfPath& otherMaterialPath)
+{
+    auto relativePath = [](SdfPath path, const SdfPath& material) -> SdfPath {
+        EnsurePathHasMaterialPrefix(path, material);
+        return path.MakeRelativePath(material);
+    };
+    auto samePath = [&](const SdfPath& path, const SdfPath& otherPath) {
+        return relativePath(path, materialPath) == relativePath(otherPath, otherMaterialPath);
+    };
+    if (networkMap.terminals.size() != otherNetworkMap.terminals.size() ||
+        networkMap.map.size() != otherNetworkMap.map.size())
+        return false;
+    for (size_t i = 0; i < networkMap.terminals.size(); ++i) {
+        if (!samePath(networkMap.terminals[i], otherNetworkMap.terminals[i]))
+            return false;
+    }
+    for (const auto& tokenAndMaterialNetwork : networkMap.map) {
+        const auto otherIt = otherNetworkMap.map.find(tokenAndMaterialNetwork.first);
+        if (otherIt == otherNetworkMap.map.end())
+            return false;
+        const HdMaterialNetwork& network = tokenAndMaterialNetwork.second;
+        const HdMaterialNetwork& otherNetwork = otherIt->second;
+        if (network.primvars != otherNetwork.primvars || network.nodes.size() != otherNetwork.nodes.size() ||
+            network.relationships.size() != otherNetwork.relationships.size())
+            return false;
+        for (size_t i = 0; i < network.nodes.size(); ++i) {
+            const HdMaterialNode& node = network.nodes[i];
+            const HdMaterialNode& otherNode = otherNetwork.nodes[i];
+            if (node.identifier != otherNode.identifier || node.parameters != otherNode.parameters ||
+                !samePath(node.path, otherNode.path))
+                return false;
+        }
+        for (size_t i = 0; i < network.relationships.size(); ++i) {
+            const HdMaterialRelationship& relationship = network.relationships[i];
+            const HdMaterialRelationship& otherRelationship = otherNetwork.relationships[i];
+            if (relationship.inputName != otherRelationship.inputName ||
+                relationship.outputName != otherRelationship.outputName ||
+                !samePath(relationship.inputId, otherRelationship.inputId) ||
+                !samePath(relationship.outputId, otherRelationship.outputId))
+                return false;
+        }
+    }
+    return true;
+}
+
 // MaterialReader classes are shared between the procedural and delegate code
 // to hold information needed to translate a shading tree.
 class MaterialHydraReader : public MaterialReader
@@ -149,6 +287,9 @@ HdArnoldNodeGraph::~HdArnoldNodeGraph()
     // We need to clear the external dependencies on the Material, it happens when the Material has
     // a camera_projection shader connected to a camera.
     _renderDelegate->ClearDependencies(GetId());
+    // Node graphs using our shaders are marked dirty by the render delegate, since they depend on us.
+    if (_networkHash != 0 && !_usesSharedNetwork)
+        _renderDelegate->ReleaseMaterialNetwork(_networkHash, this);
 
     // Ensure all AtNodes created for this node graph are properly deleted
     for (const auto& node : _nodes) {
@@ -162,6 +303,7 @@ HdArnoldNodeGraph::~HdArnoldNodeGraph()
 void HdArnoldNodeGraph::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits)
 {
     AiProfileBlock("hydra_proc:HdArnoldNodeGraph:Sync");
+    ArnoldUsdProfileScope profileScope("sync", "HdArnoldNodeGraph");
     TRACE_FUNCTION();
     if (!_renderDelegate->CanUpdateScene())
         return;
@@ -199,102 +341,111 @@ void HdArnoldNodeGraph::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* rend
                 param.Interrupt();
 
             const HdMaterialNetworkMap& materialNetworkmap = value.UncheckedGet<HdMaterialNetworkMap>();
-            // Before translation starts, we store the previous list of AtNodes
-            // for this NodeGraph. After we translated everything, all unused nodes
-            // in this list will be destroyed
-            _previousNodes = _nodes;
-
-            // Retain the network so per-rprim coordinate-system variants can be
-            // re-translated on demand (see _BuildCoordSysVariant). The base claim
-            // and the variants (their suffix + remap) are deliberately kept across
-            // re-syncs: re-translating resets the base nodes to their pristine
-            // "space" and destroys the variant nodes, so we rebuild both further
-            // below (_RebuildCoordSysRemaps) from the retained state, reusing the
-            // same node names so dependent rprims keep valid, correctly-remapped
-            // shader pointers without needing to re-sync.
-            _materialNetworkMap = materialNetworkmap;
-
-            // terminals contains the list of terminal node paths
-            // whether it's for displacement, surface, volume, etc...
-            // As we'll use this to identify the networks root shaders, 
-            // we copy the vector and we'll remove elements as we find them.
-            // Note that this vector should only have a single or a few elements.
-            std::vector<SdfPath> terminals = materialNetworkmap.terminals;
-            for (auto &ter :terminals) {
-                EnsurePathHasMaterialPrefix(ter, GetId());
-            }
-            for (const auto& tokenAndMaterialNetwork : materialNetworkmap.map) {
-                // terminalType tells us which type of network this is meant to be
-                // (surface, displacement, etc...). We're using it to identify a 
-                // special case for displacement with UsdPreviewSurface
-                const TfToken& terminalType = tokenAndMaterialNetwork.first;
-
-                // network will contain the list of shaders nodes to translate, 
-                // as well as the list of relationships (shader connections)
-                HdMaterialNetwork network = tokenAndMaterialNetwork.second;
-                // If this network doesn't contain any node, then there's nothing to do
-                if (network.nodes.empty())
-                    continue;
-                 // Make sure all paths in the material network are prefixed with the material path
-                 // This is due to hydra2 removing the prefix of the materials of the shader nodes
-                EnsureMaterialNetworPathsPrefix(network, GetId());
-
-                // Read the material network and retrieve the "root" shader that will referenced
-                // from other nodes through one of our terminals. 
-                AtNode* node = ReadMaterialNetwork(network, terminalType, terminals);
-                AtNode* oldTerminal = nullptr;
-                // UpdateTerminal assigns a given shader to a terminal name
-                if (node && _nodeGraphCache.UpdateTerminal(
-                        terminalType, node, oldTerminal)) {
-                    nodeGraphChanged = true;
+            if (_ShareIdenticalNetwork(materialNetworkmap, nodeGraphChanged)) {
+                // An identical network was already translated by another node graph
+                _materialNetworkMap = materialNetworkmap;
+            } else if (_wasSyncedOnce && _UpdateChangedShaders(materialNetworkmap, nodeGraphChanged)) {
+                // Only parameter values or connections changed, the existing Arnold
+                // shaders were updated in place
+                _materialNetworkMap = materialNetworkmap;
+            } else {
+                // Before translation starts, we store the previous list of AtNodes
+                // for this NodeGraph. After we translated everything, all unused nodes
+                // in this list will be destroyed
+                _previousNodes = _nodes;
+
+                // Retain the network so per-rprim coordinate-system variants can be
+                // re-translated on demand (see _BuildCoordSysVariant). The base claim
+                // and the variants (their suffix + remap) are deliberately kept across
+                // re-syncs: re-translating resets the base nodes to their pristine
+                // "space" and destroys the variant nodes, so we rebuild both further
+                // below (_RebuildCoordSysRemaps) from the retained state, reusing the
+                // same node names so dependent rprims keep valid, correctly-remapped
+                // shader pointers without needing to re-sync.
+                _materialNetworkMap = materialNetworkmap;
+
+                // terminals contains the list of terminal node paths
+                // whether it's for displacement, surface, volume, etc...
+                // As we'll use this to identify the networks root shaders, 
+                // we copy the vector and we'll remove elements as we find them.
+                // Note that this vector should only have a single or a few elements.
+                std::vector<SdfPath> terminals = materialNetworkmap.terminals;
+                for (auto &ter :terminals) {
+                    EnsurePathHasMaterialPrefix(ter, GetId());
                 }
+                for (const auto& tokenAndMaterialNetwork : materialNetworkmap.map) {
+                    // terminalType tells us which type of network this is meant to be
+                    // (surface, displacement, etc...). We're using it to identify a 
+                    // special case for displacement with UsdPreviewSurface
+                    const TfToken& terminalType = tokenAndMaterialNetwork.first;
+
+                    // network will contain the list of shaders nodes to translate, 
+                    // as well as the list of relationships (shader connections)
+                    HdMaterialNetwork network = tokenAndMaterialNetwork.second;
+                    // If this network doesn't contain any node, then there's nothing to do
+                    if (network.nodes.empty())
+                        continue;
+                     // Make sure all paths in the material network are prefixed with the material path
+                     // This is due to hydra2 removing the prefix of the materials of the shader nodes
+                    EnsureMaterialNetworPathsPrefix(network, GetId());
+
+                    // Read the material network and retrieve the "root" shader that will referenced
+                    // from other nodes through one of our terminals. 
+                    AtNode* node = ReadMaterialNetwork(network, terminalType, terminals);
+                    AtNode* oldTerminal = nullptr;
+                    // UpdateTerminal assigns a given shader to a terminal name
+                    if (node && _nodeGraphCache.UpdateTerminal(
+                            terminalType, node, oldTerminal)) {
+                        nodeGraphChanged = true;
+                    }
                 
-                // Special case for light filters, we need to flush the cache to ensure
-                // they're properly updated in Arnold
-                if (_wasSyncedOnce && (terminalType == str::color || terminalType.GetString().rfind(
-                        "light_filter", 0) == 0)) {
-                    nodeGraphChanged = true;
-                    AiUniverseCacheFlush(_renderDelegate->GetUniverse(), AI_CACHE_BACKGROUND | AI_CACHE_QUAD);
-                }
-                if (nodeGraphChanged && node && oldTerminal && oldTerminal != node) {
+                    // Special case for light filters, the lights using them need to be updated
+                    // in Arnold, their importance caches are rebuilt (see GetLightShaderVersion)
+                    if (_wasSyncedOnce && (terminalType == str::color || terminalType.GetString().rfind(
+                            "light_filter", 0) == 0)) {
+                        nodeGraphChanged = true;
+                        _lightShaderVersion++;
+                    }
+                    if (nodeGraphChanged && node && oldTerminal && oldTerminal != node) {
                     
-                    auto replaceOldTerminal = [&](std::unordered_map<std::string, AtNode*> &nodesList) -> bool {
-                        for (const auto& n : nodesList) {
-                            if (n.second == oldTerminal) {
-                                // Tell arnold to replace all links to the previous node with links to the new node
-                                AiNodeReplace(oldTerminal, node, false);
-                                return true;
+                        auto replaceOldTerminal = [&](std::unordered_map<std::string, AtNode*> &nodesList) -> bool {
+                            for (const auto& n : nodesList) {
+                                if (n.second == oldTerminal) {
+                                    // Tell arnold to replace all links to the previous node with links to the new node
+                                    AiNodeReplace(oldTerminal, node, false);
+                                    return true;
+                                }
                             }
-                        }
-                        return false;
-                    };                        
-
-                    // Search for the node to be replaced in the previous nodes list, 
-                    // but also in the new one, in case the old is still part of the shading tree #2568
-                    if (!replaceOldTerminal(_previousNodes))
-                        replaceOldTerminal(_nodes);
+                            return false;
+                        };                        
+
+                        // Search for the node to be replaced in the previous nodes list, 
+                        // but also in the new one, in case the old is still part of the shading tree #2568
+                        if (!replaceOldTerminal(_previousNodes))
+                            replaceOldTerminal(_nodes);
+                    }
                 }
-            }
-            // Re-establish the coordinate-system remaps on the freshly-translated
-            // (pristine) base and rebuild the per-rprim variants, BEFORE the unused-
-            // node sweep so the rebuilt variant nodes (recreated under their stored
-            // names) are kept rather than deleted.
-            _RebuildCoordSysRemaps(sceneDelegate->GetRenderIndex());
-            // Loop through previous AtNodes that were created for this node graph.
-            // If they're not empty in this list, it means that they're not used anymore.
-            // Let's delete the unused ones
-            for (const auto& previousNode : _previousNodes) {
-                if (previousNode.second) {
-                    // Destroy the arnold node
-                    _renderDelegate->DestroyArnoldNode(previousNode.second);
-                    // Remove this pointer from our list of nodes
-                    auto it = _nodes.find(previousNode.first);
-                    if (it != _nodes.end())
-                        _nodes.erase(it);
-
+                // Re-establish the coordinate-system remaps on the freshly-translated
+                // (pristine) base and rebuild the per-rprim variants, BEFORE the unused-
+                // node sweep so the rebuilt variant nodes (recreated under their stored
+                // names) are kept rather than deleted.
+                _RebuildCoordSysRemaps(sceneDelegate->GetRenderIndex());
+                // Loop through previous AtNodes that were created for this node graph.
+                // If they're not empty in this list, it means that they're not used anymore.
+                // Let's delete the unused ones
+                for (const auto& previousNode : _previousNodes) {
+                    if (previousNode.second) {
+                        // Destroy the arnold node
+                        _renderDelegate->DestroyArnoldNode(previousNode.second);
+                        // Remove this pointer from our list of nodes
+                        auto it = _nodes.find(previousNode.first);
+                        if (it != _nodes.end())
+                            _nodes.erase(it);
+
+                    }
                 }
+                _previousNodes.clear();
             }
-            _previousNodes.clear();
         }
         // We only mark the material dirty if one of the terminals have changed, but ignore the initial sync, because we
         // expect Hydra to do the initial assignment correctly.
@@ -310,6 +461,118 @@ void HdArnoldNodeGraph::Sync(HdSceneDelegate* sceneDelegate, HdRenderParam* rend
     _wasSyncedOnce = true;
 }
 
+bool HdArnoldNodeGraph::_ShareIdenticalNetwork(const HdMaterialNetworkMap& materialNetworkMap, bool& nodeGraphChanged)
+{
+    size_t hash = 0;
+    if (HdArnoldConfig::GetInstance().dedup_materials && !_imagerGraph &&
+        CanShareMaterialNetworkMap(materialNetworkMap))
+        hash = HashMaterialNetworkMap(materialNetworkMap, GetId());
+
+    // Our content changed, the node graphs using our shaders have to be synced again
+    if (_networkHash != 0 && !_usesSharedNetwork && hash != _networkHash) {
+        _renderDelegate->ReleaseMaterialNetwork(_networkHash, this);
+        _renderDelegate->DirtyDependency(GetId());
+    }
+
+    const bool wasUsingSharedNetwork = _usesSharedNetwork;
+    HdArnoldNodeGraph* sharedNetwork = hash != 0 ? _renderDelegate->AcquireMaterialNetwork(hash, this) : nullptr;
+    // Switching a translated node graph to another one's shaders would leave dangling
+    // shader pointers in the rprims that weren't synced again. A different network with
+    // the same hash is translated on its own.
+    if (sharedNetwork != nullptr && sharedNetwork != this) {
+        bool canShare = _nodes.empty();
+        if (canShare && !AreMaterialNetworkMapsEqual(materialNetworkMap, GetId(),
+                            sharedNetwork->_materialNetworkMap, sharedNetwork->GetId())) {
+            AiMsgDebug("%s : material network hash collision with %s", GetId().GetText(),
+                sharedNetwork->GetId().GetText());
+            canShare = false;
+        }
+        if (!canShare) {
+            sharedNetwork = nullptr;
+            hash = 0;
+        }
+    }
+    _networkHash = hash;
+    _usesSharedNetwork = sharedNetwork != nullptr && sharedNetwork != this;
+
+    if (_usesSharedNetwork) {
+        // We need to be synced again when the shared node graph changes or is removed
+        _renderDelegate->TrackDependencies(GetId(), HdArnoldRenderDelegate::PathSetWithDirtyBits{
+                                                        {sharedNetwork->GetId(), HdMaterial::DirtyResource}});
+        nodeGraphChanged = _wasSyncedOnce;
+        return true;
+    }
+    if (wasUsingSharedNetwork) {
+        _renderDelegate->TrackDependencies(GetId(), HdArnoldRenderDelegate::PathSetWithDirtyBits{});
+        nodeGraphChanged = _wasSyncedOnce;
+    }
+    return false;
+}
+
+bool HdArnoldNodeGraph::_UpdateChangedShaders(const HdMaterialNetworkMap& materialNetworkMap, bool& nodeGraphChanged)
+{
+    // Coordinate-system remaps rewrite the "space" inputs of the translated shaders and
+    // variants are copies of the whole network, we let the full translation handle them.
+    if (_nodes.empty() || _coordSysActive.load(std::memory_order_acquire))
+        return false;
+    if (materialNetworkMap.terminals != _materialNetworkMap.terminals ||
+        materialNetworkMap.map.size() != _materialNetworkMap.map.size())
+        return false;
+
+    // Compare all the networks first, nothing must be modified if the topology changed
+    std::unordered_map<TfToken, std::unordered_set<SdfPath, TfHash>, TfToken::HashFunctor> changedShaders;
+    for (const auto& tokenAndMaterialNetwork : materialNetworkMap.map) {
+        const TfToken& terminalType = tokenAndMaterialNetwork.first;
+        const auto previousIt = _materialNetworkMap.map.find(terminalType);
+        if (previousIt == _materialNetworkMap.map.end())
+            return false;
+        // Connections define which shaders are translated for UsdPreviewSurface displacement
+        const bool allowConnectionChanges = terminalType != HdMaterialTerminalTokens->displacement;
+        std::unordered_set<SdfPath, TfHash> networkChangedShaders;
+        if (!DiffMaterialNetwork(previousIt->second, tokenAndMaterialNetwork.second, allowConnectionChanges,
+                networkChangedShaders))
+            return false;
+        if (!networkChangedShaders.empty())
+            changedShaders[terminalType] = std::move(networkChangedShaders);
+    }
+    if (changedShaders.empty())
+        return true;
+
+    const size_t createdNodeCount = _createdNodeCount;
+    // All the networks are read in the same order as a full translation, even the ones
+    // without any change, as they consume the terminals they recognize
+    std::vector<SdfPath> terminals = materialNetworkMap.terminals;
+    for (auto& ter : terminals) {
+        EnsurePathHasMaterialPrefix(ter, GetId());
+    }
+    for (const auto& tokenAndMaterialNetwork : materialNetworkMap.map) {
+        const TfToken& terminalType = tokenAndMaterialNetwork.first;
+        HdMaterialNetwork network = tokenAndMaterialNetwork.second;
+        if (network.nodes.empty())
+            continue;
+        EnsureMaterialNetworPathsPrefix(network, GetId());
+        std::unordered_set<SdfPath, TfHash> nodeFilter;
+        const auto changedIt = changedShaders.find(terminalType);
+        if (changedIt != changedShaders.end()) {
+            for (SdfPath shaderPath : changedIt->second) {
+                EnsurePathHasMaterialPrefix(shaderPath, GetId());
+                nodeFilter.insert(shaderPath);
+            }
+        }
+        ReadMaterialNetwork(network, terminalType, terminals, &nodeFilter);
+
+        // Light filters need the lights using them to be updated, as in the full translation
+        if (!nodeFilter.empty() &&
+            (terminalType == str::color || terminalType.GetString().rfind("light_filter", 0) == 0)) {
+            nodeGraphChanged = true;
+            _lightShaderVersion++;
+        }
+    }
+    // If a shader now requires a different node type, or additional nodes, the other
+    // shaders connected to it have to be translated again.
+    return _createdNodeCount == createdNodeCount;
+}
+
 void HdArnoldNodeGraph::RemapCoordSysSpaces(const std::unordered_map<std::string, CoordSysTarget>& remap)
 {
     if (remap.empty())
@@ -349,14 +612,23 @@ HdDirtyBits HdArnoldNodeGraph::GetInitialDirtyBitsMask() const { return HdMateri
 
 AtNode* HdArnoldNodeGraph::GetCachedSurfaceShader() const
 {
+    if (const auto* sharedNetwork = _GetSharedNetwork())
+        return sharedNetwork->GetCachedSurfaceShader();
     auto* terminal = _nodeGraphCache.GetTerminal(HdMaterialTerminalTokens->surface);
     return terminal == nullptr ? _renderDelegate->GetFallbackSurfaceShader() : terminal;
 }
 
-AtNode* HdArnoldNodeGraph::GetCachedDisplacementShader() const { return _nodeGraphCache.GetTerminal(str::t_displacement); }
+AtNode* HdArnoldNodeGraph::GetCachedDisplacementShader() const
+{
+    if (const auto* sharedNetwork = _GetSharedNetwork())
+        return sharedNetwork->GetCachedDisplacementShader();
+    return _nodeGraphCache.GetTerminal(str::t_displacement);
+}
 
 AtNode* HdArnoldNodeGraph::GetCachedVolumeShader() const
 {
+    if (const auto* sharedNetwork = _GetSharedNetwork())
+        return sharedNetwork->GetCachedVolumeShader();
     auto* terminal = _nodeGraphCache.GetTerminal(HdMaterialTerminalTokens->volume);
     return terminal == nullptr ? _renderDelegate->GetFallbackVolumeShader() : terminal;
 }
@@ -695,17 +967,23 @@ AtNode* HdArnoldNodeGraph::_ResolveCoordSysTerminal(const CoordSysBinding& bindi
 
 AtNode* HdArnoldNodeGraph::GetCachedSurfaceShader(const CoordSysBinding& binding)
 {
+    if (auto* sharedNetwork = _GetSharedNetwork())
+        return sharedNetwork->GetCachedSurfaceShader(binding);
     auto* terminal = _ResolveCoordSysTerminal(binding, HdMaterialTerminalTokens->surface);
     return terminal == nullptr ? _renderDelegate->GetFallbackSurfaceShader() : terminal;
 }
 
 AtNode* HdArnoldNodeGraph::GetCachedDisplacementShader(const CoordSysBinding& binding)
 {
+    if (auto* sharedNetwork = _GetSharedNetwork())
+        return sharedNetwork->GetCachedDisplacementShader(binding);
     return _ResolveCoordSysTerminal(binding, str::t_displacement);
 }
 
 AtNode* HdArnoldNodeGraph::GetCachedVolumeShader(const CoordSysBinding& binding)
 {
+    if (auto* sharedNetwork = _GetSharedNetwork())
+        return sharedNetwork->GetCachedVolumeShader(binding);
     auto* terminal = _ResolveCoordSysTerminal(binding, HdMaterialTerminalTokens->volume);
     return terminal == nullptr ? _renderDelegate->GetFallbackVolumeShader() : terminal;
 }
@@ -782,7 +1060,8 @@ std::vector<AtNode*> HdArnoldNodeGraph::GetOrCreateTerminals(
     return result;
 }
 
-AtNode* HdArnoldNodeGraph::ReadMaterialNetwork(const HdMaterialNetwork& network, const TfToken& terminalType, std::vector<SdfPath>& terminals)
+AtNode* HdArnoldNodeGraph::ReadMaterialNetwork(const HdMaterialNetwork& network, const TfToken& terminalType,
+    std::vector<SdfPath>& terminals, const std::unordered_set<SdfPath, TfHash>* nodeFilter)
 {
     AiProfileBlock("hydra_proc:HdArnoldNodeGraph:ReadMaterialNetwork");
     TRACE_FUNCTION();
@@ -892,6 +1171,9 @@ AtNode* HdArnoldNodeGraph::ReadMaterialNetwork(const HdMaterialNetwork& network,
         if (!includedShaders.empty() && 
             includedShaders.find(node.path) == includedShaders.end())
             continue;
+        // Only the shaders that changed since the previous translation are read again
+        if (nodeFilter && nodeFilter->find(node.path) == nodeFilter->end())
+            continue;
 
         inputAttrs.clear();
         bool isCameraProjection = (node.identifier == str::t_camera_projection);
@@ -182,10 +182,21 @@ public:
         AtNode* node = _renderDelegate->CreateArnoldNode(AtString(nodeType), AtString(nodeName));
         // Store this node in our local list
         _nodes[nodeName] = node;
+        _createdNodeCount++;
         return node;
     }    
 
 
+    /// Returns the amount of times the light color or light filter networks of this
+    /// graph were updated after its first sync.
+    ///
+    /// Arnold doesn't see the changes of the shaders linked to a light, so lights
+    /// caching importance tables (skydome, quad and mesh lights) compare this value
+    /// to know when they have to be rebuilt.
+    ///
+    /// @return Version of the light shaders.
+    unsigned int GetLightShaderVersion() const { return _lightShaderVersion; }
+
     /// Notify this graph that it is an imager graph, which requires a different
     /// way to update the render
     HDARNOLD_API
@@ -339,10 +350,11 @@ protected:
     /// @param network Const Reference to the Hydra Material Network.
     /// @param terminalType Type of the shading network (surface, displacement, volume, etc...)
     /// @param terminals Reference of a list of terminals root nodes, where elements can be removed inside the call
-    /// @return Returns the Entry Point to the Arnold Shader Network.
+    /// @param nodeFilter Optional list of shaders to translate, the other ones are left untouched
+    /// @return Returns the Entry Point to the Arnold Shader Network, or nullptr if it was filtered out.
     HDARNOLD_API
     AtNode* ReadMaterialNetwork(const HdMaterialNetwork& network, const TfToken& terminalType,
-        std::vector<SdfPath>& terminals);
+        std::vector<SdfPath>& terminals, const std::unordered_set<SdfPath, TfHash>* nodeFilter = nullptr);
 
     /// Return the @p terminalName terminal to use for a given rprim's @p binding:
     /// the base network (no coordinate systems, or the first/matching binding), or
@@ -363,6 +375,31 @@ protected:
     /// non-coordinate-system materials incur no variant handling).
     std::string _CoordSysSignature(const CoordSysRemap& remap) const;
 
+    /// Translate again only the shaders whose parameters or input connections changed
+    /// since the retained network (_materialNetworkMap), reusing their Arnold nodes.
+    /// This avoids rebuilding the whole shading tree when a single value is edited.
+    ///
+    /// @param materialNetworkMap New material network map for this node graph.
+    /// @param nodeGraphChanged Set to true if dependent prims have to be updated.
+    /// @return False if the network topology changed, and a full translation is required.
+    bool _UpdateChangedShaders(const HdMaterialNetworkMap& materialNetworkMap, bool& nodeGraphChanged);
+
+    /// When HDARNOLD_dedup_materials is enabled, register the content hash of the material
+    /// network map, and use the shaders of the first node graph registered with the same
+    /// hash instead of translating it again. Only node graphs that were never translated
+    /// switch to shared shaders, so that rprims never keep pointers to destroyed nodes.
+    ///
+    /// @param materialNetworkMap New material network map for this node graph.
+    /// @param nodeGraphChanged Set to true if dependent prims have to be updated.
+    /// @return True if this node graph uses the shaders of another one and must not be translated.
+    bool _ShareIdenticalNetwork(const HdMaterialNetworkMap& materialNetworkMap, bool& nodeGraphChanged);
+
+    /// Returns the node graph whose shaders are used by this one, or nullptr.
+    HdArnoldNodeGraph* _GetSharedNetwork() const
+    {
+        return _usesSharedNetwork ? _renderDelegate->GetMaterialNetwork(_networkHash) : nullptr;
+    }
+
     /// Re-establish the base remap and rebuild the per-rprim variants after a
     /// (re-)translation, so they survive re-syncs with stable Arnold node pointers.
     /// Also the garbage-collection point for claims whose rprim has been removed
@@ -428,11 +465,19 @@ protected:
     HdArnoldRenderDelegate* _renderDelegate; ///< Pointer to the Render Delegate.
     bool _wasSyncedOnce = false;             ///< Whether or not the material has been synced at least once.
     bool _imagerGraph = false;
+    unsigned int _lightShaderVersion = 0; ///< Incremented when light color or filter networks change.
     std::unordered_map<std::string, AtNode*> _nodes;  /// List of nodes used in this translator
     std::unordered_map<std::string, AtNode*> _previousNodes;  /// Transient list of previously stored nodes
     /// When set, CreateArnoldNode records the names it hands out here. Only set while
     /// a coordinate-system variant is being translated (see _BuildCoordSysVariant).
     std::vector<std::string>* _nodeCaptureList = nullptr;
+    /// Amount of Arnold nodes created by CreateArnoldNode (rather than reused).
+    size_t _createdNodeCount = 0;
+    /// Content hash this node graph is registered with in the render delegate, 0 if none.
+    size_t _networkHash = 0;
+    /// Whether the shaders of the node graph registered with _networkHash are used
+    /// instead of translating this one.
+    bool _usesSharedNetwork = false;
 
     /// A per-rprim coordinate-system variant of the material: its unique node-name
     /// suffix, the remap that produced it, and the resulting terminal cache. Kept
@@ -36,6 +36,7 @@
 
 #include <constant_strings.h>
 
+#include "../render_param.h"
 #include "../utils.h"
 #include "nodes.h"
 
@@ -73,6 +74,7 @@ node_parameters
     AiParameterPtr(str::color_pointer, nullptr);
     AiParameterPtr(str::depth_pointer, nullptr);
     AiParameterPtr(str::id_pointer, nullptr);
+    AiParameterPtr(str::render_param_pointer, nullptr);
     AiParameterArray(str::buffer_names, AiArray(0, 0, AI_TYPE_STRING));
     AiParameterArray(str::buffer_pointers, AiArray(0, 0, AI_TYPE_POINTER));
     AiMetaDataSetBool(nentry, NULL, "parallel_driver_needs_bucket", true);
@@ -98,6 +100,7 @@ node_update
     data->colorBuffer = static_cast<HdArnoldRenderBuffer*>(AiNodeGetPtr(node, str::color_pointer));
     data->depthBuffer = static_cast<HdArnoldRenderBuffer*>(AiNodeGetPtr(node, str::depth_pointer));
     data->idBuffer = static_cast<HdArnoldRenderBuffer*>(AiNodeGetPtr(node, str::id_pointer));
+    data->renderParam = static_cast<HdArnoldRenderParam*>(AiNodeGetPtr(node, str::render_param_pointer));
 
     // Store the region min X/Y so that we can apply an offset when
     // negative pixel coordinates are needed for overscan.
@@ -152,6 +155,8 @@ driver_prepare_bucket {}
 driver_process_bucket
 {
     auto* driverData = reinterpret_cast<DriverMainData*>(AiNodeGetLocalData(node));
+    if (driverData->renderParam)
+        driverData->renderParam->NotifyBucketWritten();
     AtString outputName;
     int pixelType = AI_TYPE_RGBA;
     const void* bucketData = nullptr;
@@ -50,12 +50,16 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class HdArnoldRenderParam;
+
 struct DriverMainData {
     GfMatrix4f projMtx = GfMatrix4f{1.0f};
     GfMatrix4f viewMtx = GfMatrix4f{1.0f};
     HdArnoldRenderBuffer* colorBuffer = nullptr;
     HdArnoldRenderBuffer* depthBuffer = nullptr;
     HdArnoldRenderBuffer* idBuffer = nullptr;
+    // Render param notified when buckets are received, to measure the first pixel latency.
+    HdArnoldRenderParam* renderParam = nullptr;
     // Local storage for converting from P to depth.
     std::vector<float> depths[AI_MAX_THREADS];
     // Local storage for the id remapping.
@@ -6,7 +6,9 @@
 #include <constant_strings.h>
 #include <pxr/base/arch/env.h>
 #include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/trace/trace.h>
+#include <chrono>
 #include <iostream>
 #include <vector>
 #include <iostream>
@@ -27,6 +29,7 @@
 #include "render_delegate.h"
 #include "render_pass.h"
 
+#include "profile_utils.h"
 #include "rendersettings_utils.h"
 PXR_NAMESPACE_USING_DIRECTIVE
 #include "api_adapter.h"
@@ -145,6 +148,41 @@ private:
     double _shutterEnd = 0.;
 };
 
+namespace {
+
+// Upper bound on the amount of sync passes done to resolve the dependencies between prims.
+// Each pass only syncs the prims dirtied by the previous one, so a scene needing more than that
+// has prims that keep on invalidating each other.
+constexpr int maxSyncPasses = 16;
+
+// Returns the amount of prims that the next SyncAll will actually translate. This walks the whole
+// render index, so it's only used for the debug logs.
+size_t _CountDirtyPrims(HdRenderIndex *renderIndex, const HdRenderDelegate *renderDelegate)
+{
+    const SdfPath &root = SdfPath::AbsoluteRootPath();
+    HdChangeTracker &changeTracker = renderIndex->GetChangeTracker();
+    size_t dirtyPrims = 0;
+    for (const SdfPath &id : renderIndex->GetRprimIds()) {
+        if (!HdChangeTracker::IsClean(changeTracker.GetRprimDirtyBits(id)))
+            ++dirtyPrims;
+    }
+    for (const TfToken &type : renderDelegate->GetSupportedSprimTypes()) {
+        for (const SdfPath &id : renderIndex->GetSprimSubtree(type, root)) {
+            if (!HdChangeTracker::IsClean(changeTracker.GetSprimDirtyBits(id)))
+                ++dirtyPrims;
+        }
+    }
+    for (const TfToken &type : renderDelegate->GetSupportedBprimTypes()) {
+        for (const SdfPath &id : renderIndex->GetBprimSubtree(type, root)) {
+            if (!HdChangeTracker::IsClean(changeTracker.GetBprimDirtyBits(id)))
+                ++dirtyPrims;
+        }
+    }
+    return dirtyPrims;
+}
+
+} // namespace
+
 HydraArnoldReader::~HydraArnoldReader() 
 {
     // Warn the render delegate that we're deleting it because the reader is being destroyed.
@@ -294,6 +332,8 @@ void HydraArnoldReader::ReadStage(UsdStageRefPtr stage,
 
     AtNode *universeCamera = AiUniverseGetCamera(_universe);
     _renderCameraPath = SdfPath();
+    // Shared by the render settings and camera lookups below, so that we traverse the stage at most once
+    ArnoldUsdStageRenderPrims renderPrims(stage);
 
     // Find the camera as its motion blur values influence how hydra generates the geometry
     if (!arnoldRenderDelegate->GetProceduralParent()) {
@@ -305,7 +345,7 @@ void HydraArnoldReader::ReadStage(UsdStageRefPtr stage,
 
         {
             TRACE_SCOPE("ChooseRenderSettings");
-            ChooseRenderSettings(stage, _renderSettings, _time);
+            ChooseRenderSettings(stage, _renderSettings, _time, nullptr, &renderPrims);
         }
 
         if (!_renderSettings.empty()) {
@@ -342,14 +382,9 @@ void HydraArnoldReader::ReadStage(UsdStageRefPtr stage,
             SetCameraForSampling(stage, _renderCameraPath);
         } else {
             // Use the first camera available
-            for (const auto &it: stage->Traverse()) {
-                if (it.IsA<UsdGeomCamera>()) {
-                    UsdPrim cameraPrim = it;
-                    _renderCameraPath = cameraPrim.GetPath();
-                    SetCameraForSampling(stage, _renderCameraPath);
-                    break;
-                }
-            }
+            _renderCameraPath = renderPrims.GetFirstCamera();
+            if (!_renderCameraPath.IsEmpty())
+                SetCameraForSampling(stage, _renderCameraPath);
         }
     }
     
@@ -360,6 +395,7 @@ void HydraArnoldReader::ReadStage(UsdStageRefPtr stage,
 
     {
 		TRACE_SCOPE("Populate/SetStage");
+		ArnoldUsdProfileScope profileScope("phases", "hydra_populate", true);
 		// We want to render the purpose that this reader was assigned to.
 		// We also support the purposes "default" and "geometry" that are always rendered
 		// so we don't need to provide it here
@@ -410,23 +446,71 @@ void HydraArnoldReader::ReadStage(UsdStageRefPtr stage,
     // SdfPathVector root;
     // root.push_back(SdfPath("/"));
     // collection.SetRootPaths(root);
+    using SyncClock = std::chrono::steady_clock;
+    // Counting the prims synced by each pass walks the render index, only do it if it's logged
+    const bool logSyncPasses =
+        ((AiMsgGetConsoleFlags(_universe) | AiMsgGetLogFileFlags(_universe)) & AI_LOG_DEBUG) != 0;
+    const size_t insertedPrims = logSyncPasses ? _CountDirtyPrims(_renderIndex, arnoldRenderDelegate) : 0;
+    HdChangeTracker &changeTracker = _renderIndex->GetChangeTracker();
+    const auto syncStart = SyncClock::now();
+    // The scene state version changes whenever a prim is marked dirty, including when prims dirty
+    // each other while they're synced, so it tells in O(1) if another SyncAll has anything to do.
+    unsigned int syncedSceneStateVersion = changeTracker.GetSceneStateVersion();
     {
         TRACE_SCOPE("SyncAll");
+        ArnoldUsdProfileScope profileScope("phases", "hydra_sync", true);
         _renderIndex->SyncAll(&_tasks, &_taskContext);
     }
     {
         TRACE_SCOPE("ProcessConnections");
+        ArnoldUsdProfileScope profileScope("phases", "hydra_connections", true);
         arnoldRenderDelegate->ProcessConnections();
     }
-        
+    auto passEnd = SyncClock::now();
+    if (logSyncPasses) {
+        AiMsgDebug("[usd] hydra sync pass 1 : %zu prims, %.2f ms", insertedPrims,
+            std::chrono::duration<double, std::milli>(passEnd - syncStart).count());
+    }
+
     // The scene might not be up to date, because of light links, etc, that were generated during the first sync.
     // HasPendingChanges updates the dirtybits for a resync, this is how it works in our hydra render pass.
+    // Each extra pass only has to translate the prims that were dirtied by the previous one. We check the change
+    // tracker before calling SyncAll, as it would otherwise walk the whole render index to find out that
+    // the pending changes were already applied directly on the arnold nodes.
     {
         TRACE_SCOPE("PendingChanges");
+        ArnoldUsdProfileScope profileScope("phases", "hydra_pending_changes", true);
+        int pass = 1;
+        size_t dirtyPrims = 0;
         while (arnoldRenderDelegate->HasPendingChanges(_renderIndex, _renderCameraPath, _shutter)) {
-            _renderIndex->SyncAll(&_tasks, &_taskContext);
+            const auto passStart = SyncClock::now();
+            const unsigned int sceneStateVersion = changeTracker.GetSceneStateVersion();
+            const bool hasDirtyPrims = sceneStateVersion != syncedSceneStateVersion;
+            if (hasDirtyPrims) {
+                if (pass >= maxSyncPasses) {
+                    const AtNode *procParent = arnoldRenderDelegate->GetProceduralParent();
+                    AiMsgWarning("[usd] %s : hydra sync did not converge after %d passes, prims are still dirty",
+                        procParent ? AiNodeGetName(procParent) : "", pass);
+                    break;
+                }
+                ++pass;
+                syncedSceneStateVersion = sceneStateVersion;
+                dirtyPrims = logSyncPasses ? _CountDirtyPrims(_renderIndex, arnoldRenderDelegate) : 0;
+                _renderIndex->SyncAll(&_tasks, &_taskContext);
+            }
             arnoldRenderDelegate->ProcessConnections();
+            passEnd = SyncClock::now();
+            if (hasDirtyPrims) {
+                if (logSyncPasses) {
+                    AiMsgDebug("[usd] hydra sync pass %d : %zu prims, %.2f ms", pass, dirtyPrims,
+                        std::chrono::duration<double, std::milli>(passEnd - passStart).count());
+                }
+                if (ArnoldUsdProfiler::IsEnabled())
+                    ArnoldUsdProfiler::Record("sync_passes", TfStringPrintf("pass_%d", pass), passStart, passEnd);
+            }
         }
+        AiMsgDebug("[usd] hydra sync : %d passes, %.2f ms", pass,
+            std::chrono::duration<double, std::milli>(passEnd - syncStart).count());
     }
 
 #ifndef ENABLE_SHARED_ARRAYS
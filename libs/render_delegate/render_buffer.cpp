@@ -29,6 +29,8 @@
 
 // memcpy
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include <iostream>
@@ -206,11 +208,117 @@ WriteBucketFunctionMap writeBucketFunctions{
     {{HdFormatInt32, HdFormatFloat32}, _WriteBucket<HdFormatInt32, HdFormatFloat32>},
 };
 
+// Render buffers are reallocated every time the viewport is resized or its region changes, which
+// happens continuously while dragging a window, for every AOV. Instead of freeing their storage,
+// we keep it in a pool shared by all the render buffers, and allocate it by size classes, so
+// successive resizes can reuse the same memory. The pool is emptied when the last render buffer
+// is destroyed, so closing the viewport gives the memory back.
+
+// Maximum amount of bytes kept in the pool, 4K RGBA float buffers are ~132MB.
+constexpr size_t _storagePoolMaxBytes = size_t(1) << 30;
+
+// Rounds the size up to 1/8th of its power of two, wasting at most 12.5% of the capacity.
+size_t _GetStorageSizeClass(size_t byteCount)
+{
+    constexpr size_t minSizeClass = 4096;
+    if (byteCount <= minSizeClass)
+        return minSizeClass;
+    size_t powerOfTwo = minSizeClass;
+    while (powerOfTwo * 2 <= byteCount)
+        powerOfTwo *= 2;
+    const size_t step = powerOfTwo / 8;
+    return (byteCount + step - 1) / step * step;
+}
+
+struct _StoragePool {
+    std::mutex mutex;
+    std::multimap<size_t, std::vector<uint8_t>> storages; ///< Released storages sorted by capacity.
+    size_t pooledBytes = 0;
+    size_t numBuffers = 0; ///< Amount of render buffers alive.
+};
+
+_StoragePool& _GetStoragePool()
+{
+    static _StoragePool pool;
+    return pool;
+}
+
+/// Gives back the storage to the pool, leaving it empty.
+void _ReleaseStorage(std::vector<uint8_t>& storage)
+{
+    std::vector<uint8_t> released;
+    released.swap(storage);
+    const size_t capacity = released.capacity();
+    if (capacity == 0)
+        return;
+    auto& pool = _GetStoragePool();
+    std::lock_guard<std::mutex> guard(pool.mutex);
+    // Forget the smallest storages first when the pool is full.
+    while (!pool.storages.empty() && pool.pooledBytes + capacity > _storagePoolMaxBytes) {
+        pool.pooledBytes -= pool.storages.begin()->first;
+        pool.storages.erase(pool.storages.begin());
+    }
+    if (capacity <= _storagePoolMaxBytes) {
+        pool.pooledBytes += capacity;
+        released.clear();
+        pool.storages.emplace(capacity, std::move(released));
+    }
+}
+
+/// Registers a new render buffer using the pool.
+void _RegisterBuffer()
+{
+    auto& pool = _GetStoragePool();
+    std::lock_guard<std::mutex> guard(pool.mutex);
+    pool.numBuffers++;
+}
+
+/// Gives back the storage of a destroyed render buffer, and empties the pool if it was the last one.
+void _UnregisterBuffer(std::vector<uint8_t>& storage)
+{
+    _ReleaseStorage(storage);
+    std::multimap<size_t, std::vector<uint8_t>> storages;
+    {
+        auto& pool = _GetStoragePool();
+        std::lock_guard<std::mutex> guard(pool.mutex);
+        if (--pool.numBuffers == 0) {
+            // Free the memory outside of the lock.
+            storages.swap(pool.storages);
+            pool.pooledBytes = 0;
+        }
+    }
+}
+
+/// Resizes the storage to byteCount zeroed bytes, reusing its capacity or one from the pool
+/// if possible.
+void _AcquireStorage(std::vector<uint8_t>& storage, size_t byteCount)
+{
+    if (storage.capacity() < byteCount) {
+        _ReleaseStorage(storage);
+        const size_t sizeClass = _GetStorageSizeClass(byteCount);
+        auto& pool = _GetStoragePool();
+        {
+            std::lock_guard<std::mutex> guard(pool.mutex);
+            // Don't pick a storage much bigger than what we need, it would be better used by another buffer.
+            auto it = pool.storages.lower_bound(sizeClass);
+            if (it != pool.storages.end() && it->first <= sizeClass * 2) {
+                pool.pooledBytes -= it->first;
+                storage.swap(it->second);
+                pool.storages.erase(it);
+            }
+        }
+        if (storage.capacity() < byteCount)
+            storage.reserve(sizeClass);
+    }
+    storage.assign(byteCount, 0);
+}
+
 } // namespace
 
 HdArnoldRenderBuffer::HdArnoldRenderBuffer(HdArnoldRenderDelegate* renderDelegate, 
     const SdfPath& id) : HdRenderBuffer(id), _renderDelegate(renderDelegate)
 {
+    _RegisterBuffer();
 }
 
 namespace {
@@ -436,9 +544,6 @@ _GpuFlipBlit _gpuFlipBlit;
 bool HdArnoldRenderBuffer::Allocate(const GfVec3i& dimensions, HdFormat format, bool multiSampled)
 {
     std::lock_guard<std::mutex> _guard(_mutex);
-    // So deallocate won't lock.
-    decltype(_buffer) tmp{};
-    _buffer.swap(tmp);
     if (_hgi != nullptr) {
         if (_aovTexture) {
             _hgi->DestroyTexture(&_aovTexture);
@@ -448,6 +553,7 @@ bool HdArnoldRenderBuffer::Allocate(const GfVec3i& dimensions, HdFormat format,
         }
     }
     if (!_SupportedComponentFormat(format)) {
+        _ReleaseStorage(_buffer);
         _width = 0;
         _height = 0;
         return false;
@@ -470,10 +576,18 @@ bool HdArnoldRenderBuffer::Allocate(const GfVec3i& dimensions, HdFormat format,
 #endif
 
     // --CPU buffers--
-    const auto byteCount = _width * _height * HdDataSizeOfFormat(format);
+    // The storage keeps its capacity when the buffer shrinks, so the data pointer handed to the
+    // driver only changes when the buffer grows past its size class.
+    const size_t byteCount = static_cast<size_t>(_width) * _height * HdDataSizeOfFormat(format);
     if (byteCount != 0) {
-        _buffer.resize(byteCount, 0);
+        _AcquireStorage(_buffer, byteCount);
+    } else {
+        _ReleaseStorage(_buffer);
     }
+    // The whole buffer was cleared
+    _pendingDirtyRegion = DirtyRegion{};
+    if (_width > 0 && _height > 0)
+        _pendingDirtyRegion.Add(0, 0, static_cast<int>(_width) - 1, static_cast<int>(_height) - 1);
     return true;
 }
 
@@ -599,11 +713,15 @@ void HdArnoldRenderBuffer::Unmap()
 
 bool HdArnoldRenderBuffer::IsMapped() const { return false; }
 
+HdArnoldRenderBuffer::~HdArnoldRenderBuffer()
+{
+    _UnregisterBuffer(_buffer);
+}
+
 void HdArnoldRenderBuffer::_Deallocate()
 {
     std::lock_guard<std::mutex> _guard(_mutex);
-    decltype(_buffer) tmp{};
-    _buffer.swap(tmp);
+    _ReleaseStorage(_buffer);
     if (_hgi != nullptr) {
         if (_aovTexture) {
             _hgi->DestroyTexture(&_aovTexture);
@@ -643,6 +761,10 @@ void HdArnoldRenderBuffer::WriteBucket(
     if (ye == yo) {
         return;
     }
+    // Rows are stored bottom to top
+    _pendingDirtyRegion.Add(
+        static_cast<int>(xo), static_cast<int>(_height - ye), static_cast<int>(xe) - 1,
+        static_cast<int>(_height - yo) - 1);
     const auto dataWidth = (xe - xo);
     // Single component formats can be:
     //  - HdFormatUNorm8
@@ -707,4 +829,21 @@ void HdArnoldRenderBuffer::WriteBucket(
     }
 }
 
+void HdArnoldRenderBuffer::PublishDirtyRegion()
+{
+    std::lock_guard<std::mutex> _guard(_mutex);
+    if (_pendingDirtyRegion.IsEmpty())
+        return;
+    _dirtyRegion = _pendingDirtyRegion;
+    _pendingDirtyRegion = DirtyRegion{};
+    _dirtyRegionVersion++;
+}
+
+HdArnoldRenderBuffer::DirtyRegion HdArnoldRenderBuffer::GetDirtyRegion() const
+{
+    auto* self = const_cast<HdArnoldRenderBuffer*>(this);
+    std::lock_guard<std::mutex> guard(self->_mutex);
+    return _dirtyRegion;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
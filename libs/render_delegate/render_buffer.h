@@ -32,6 +32,7 @@
 #include <pxr/imaging/hgi/hgi.h>
 #include <pxr/imaging/hgi/texture.h>
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <unordered_map>
@@ -49,7 +50,7 @@ public:
     HdArnoldRenderBuffer(HdArnoldRenderDelegate* renderDelegate, const SdfPath& id);
 
     HDARNOLD_API
-    ~HdArnoldRenderBuffer() override = default;
+    ~HdArnoldRenderBuffer() override;
 
     HDARNOLD_API
     bool Allocate(const GfVec3i& dimensions, HdFormat format, bool multiSampled) override;
@@ -113,6 +114,45 @@ public:
     void WriteBucket(
         unsigned int bucketXO, unsigned int bucketYo, unsigned int bucketWidth, unsigned int bucketHeight,
         HdFormat format, const void* bucketData);
+
+    /// Rectangle of pixels modified in the buffer, using the layout of the data returned by Map.
+    /// Bounds are inclusive.
+    struct DirtyRegion {
+        int minX = 0;
+        int minY = 0;
+        int maxX = -1;
+        int maxY = -1;
+
+        bool IsEmpty() const { return maxX < minX || maxY < minY; }
+        void Add(int x0, int y0, int x1, int y1)
+        {
+            if (IsEmpty()) {
+                minX = x0;
+                minY = y0;
+                maxX = x1;
+                maxY = y1;
+            } else {
+                minX = std::min(minX, x0);
+                minY = std::min(minY, y0);
+                maxX = std::max(maxX, x1);
+                maxY = std::max(maxY, y1);
+            }
+        }
+    };
+
+    /// Publishes the buckets written since the previous call, coalesced into a single region.
+    ///
+    /// The render pass calls this at the interactive target rate, and reports the published regions
+    /// in the dirtyRegions render stats, so hosts can only upload that region instead of the whole buffer.
+    HDARNOLD_API
+    void PublishDirtyRegion();
+
+    /// Returns the region published by the last call to PublishDirtyRegion.
+    HDARNOLD_API
+    DirtyRegion GetDirtyRegion() const;
+
+    /// Returns the number of times a non empty dirty region was published.
+    unsigned int GetDirtyRegionVersion() const { return _dirtyRegionVersion; }
     
     /// Utility class for storing render buffers.
     struct BufferDefinition {
@@ -175,6 +215,9 @@ private:
     TfToken _aovName;                                ///< AOV name passed to AiGetRenderOutput.
     bool _mapped = false;                            ///< Whether Map() left the mutex held; consulted by 
     bool _valid = true;
+    DirtyRegion _pendingDirtyRegion;                 ///< Buckets written since the last publish.
+    DirtyRegion _dirtyRegion;                        ///< Last published dirty region.
+    std::atomic<unsigned int> _dirtyRegionVersion{0}; ///< Number of published dirty regions.
 };
 
 using HdArnoldRenderBufferStorage =
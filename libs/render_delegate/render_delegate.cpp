@@ -48,6 +48,7 @@
 #ifdef ENABLE_SCENE_INDEX
 #include <pxr/imaging/hd/dirtyBitsTranslator.h>
 #include <pxr/imaging/hd/retainedDataSource.h>
+#include <pxr/imaging/hd/sceneIndexObserver.h>
 #endif
 #include <common_utils.h>
 #include <constant_strings.h>
@@ -71,6 +72,7 @@
 #include "render_buffer.h"
 #include "render_pass.h"
 #include "volume.h"
+#include <algorithm>
 #include <cctype>
 #include "render_settings.h"
 
@@ -91,6 +93,10 @@ TF_DEFINE_PRIVATE_TOKENS(_tokens,
     (percentDone)
     (totalClockTime)
     (renderProgressAnnotation)
+    (aovRestarts)
+    (firstPixelLatency)
+    (progressiveMinAASamples)
+    (dirtyRegions)
     (delegateRenderProducts)
     (orderedVars)
     ((aovSettings, "aovDescriptor.aovSettings"))
@@ -494,6 +500,21 @@ void _RemoveArnoldGlobalPrefix(const TfToken& key, TfToken& key_new)
         key_new = key;
 }
 
+#ifdef ENABLE_SCENE_INDEX
+// Dirtied entries carried by the ArnoldMarkPrimsDirty message to the PropagateDirtyPrimsSceneIndex.
+// DirtiedPrimEntries can't be stored directly in a data source, as VtValue requires an equality
+// operator, so the entries are shared through a pointer which also avoids copying them.
+using _SharedDirtiedPrimEntries = std::shared_ptr<const HdSceneIndexObserver::DirtiedPrimEntries>;
+
+void _MarkPrimsDirty(const HdSceneIndexBaseRefPtr& sceneIndex, HdSceneIndexObserver::DirtiedPrimEntries&& entries)
+{
+    sceneIndex->SystemMessage(
+        str::t_ArnoldMarkPrimsDirty,
+        HdRetainedTypedSampledDataSource<_SharedDirtiedPrimEntries>::New(
+            std::make_shared<const HdSceneIndexObserver::DirtiedPrimEntries>(std::move(entries))));
+}
+#endif
+
 } // namespace
 
 std::mutex HdArnoldRenderDelegate::_mutexResourceRegistry;
@@ -1237,6 +1258,17 @@ VtDictionary HdArnoldRenderDelegate::GetRenderStats() const
     char resolutionBuffer[maxResChars];
     snprintf(&resolutionBuffer[0], maxResChars, "%s %i x %i", renderStatus.c_str(), width, height);
     stats[_tokens->renderProgressAnnotation] = VtValue(resolutionBuffer);
+    stats[_tokens->aovRestarts] = VtValue(static_cast<int>(_aovRestarts.load()));
+    const double firstPixelLatency = _renderParam->GetFirstPixelLatency();
+    if (firstPixelLatency >= 0.0)
+        stats[_tokens->firstPixelLatency] = VtValue(firstPixelLatency / 1000.0);
+    if (_renderParam->IsProgressiveMinAASamplesAdaptive())
+        stats[_tokens->progressiveMinAASamples] = VtValue(_renderParam->GetScheduledProgressiveMinAASamples());
+    // Region of each AOV updated since the previous publish, so hosts can only upload that part of the
+    // buffer when its version increased by one.
+    VtDictionary dirtyRegions = _renderParam->GetDirtyRegions();
+    if (!dirtyRegions.empty())
+        stats[_tokens->dirtyRegions] = VtValue(std::move(dirtyRegions));
 
     if (total_progress >= 100) {
         // If there are cryptomatte drivers, we look for the metadata that is stored in each of them.
@@ -1308,6 +1340,11 @@ HdRprim* HdArnoldRenderDelegate::CreateRprim(const TfToken& typeId, const SdfPat
         return nullptr;
 
     _renderParam->Interrupt();
+    // Mesh lights reference the Arnold node of their geometry, they need to be
+    // updated if it is created after them
+    if (_targetToSourcesMap.find(rprimId) != _targetToSourcesMap.end())
+        DirtyDependency(rprimId);
+
     if (typeId == HdPrimTypeTokens->mesh) {
         return new HdArnoldMesh(this, rprimId);
     }
@@ -1338,7 +1375,15 @@ HdRprim* HdArnoldRenderDelegate::CreateRprim(const TfToken& typeId, const SdfPat
 
 void HdArnoldRenderDelegate::DestroyRprim(HdRprim* rPrim)
 {
+    if (rPrim == nullptr)
+        return;
+
     _renderParam->Interrupt();
+    // Same as for Sprims, the prims referencing the Arnold node of this Rprim
+    // (i.e. mesh lights) need to be updated
+    const auto &id = rPrim->GetId();
+    if (_targetToSourcesMap.find(id) != _targetToSourcesMap.end())
+        RemoveDependency(id);
     delete rPrim;
 }
 
@@ -1559,6 +1604,71 @@ AtNode* HdArnoldRenderDelegate::GetFallbackVolumeShader()
     return _fallbackVolumeShader;
 }
 
+AtNode* HdArnoldRenderDelegate::AcquireSharedVolume(const std::string& filename, const std::vector<std::string>& grids)
+{
+    // The order of the grids doesn't matter for the volume node
+    std::vector<std::string> sortedGrids = grids;
+    std::sort(sortedGrids.begin(), sortedGrids.end());
+    const std::string key = filename + "|" + TfStringJoin(sortedGrids, ",");
+
+    std::lock_guard<std::mutex> guard(_sharedVolumesMutex);
+    SharedVolume& sharedVolume = _sharedVolumes[key];
+    if (sharedVolume.node == nullptr) {
+        sharedVolume.node = CreateArnoldNode(str::volume,
+            AtString(TfStringPrintf("_sharedVolume_%u", _sharedVolumeCount++).c_str()));
+        AiNodeSetStr(sharedVolume.node, str::filename, AtString(filename.c_str()));
+        AtArray* gridsArray = AiArrayAllocate(sortedGrids.size(), 1, AI_TYPE_STRING);
+        for (size_t i = 0; i < sortedGrids.size(); ++i) {
+            AiArraySetStr(gridsArray, i, AtString(sortedGrids[i].c_str()));
+        }
+        AiNodeSetArray(sharedVolume.node, str::grids, gridsArray);
+        // Only the ginstances pointing to this volume are rendered
+        AiNodeSetByte(sharedVolume.node, str::visibility, 0);
+        _sharedVolumeKeys[sharedVolume.node] = key;
+    }
+    sharedVolume.refCount++;
+    return sharedVolume.node;
+}
+
+void HdArnoldRenderDelegate::ReleaseSharedVolume(AtNode* volume)
+{
+    if (volume == nullptr)
+        return;
+    std::lock_guard<std::mutex> guard(_sharedVolumesMutex);
+    const auto keyIt = _sharedVolumeKeys.find(volume);
+    if (keyIt == _sharedVolumeKeys.end())
+        return;
+    const auto volumeIt = _sharedVolumes.find(keyIt->second);
+    if (volumeIt != _sharedVolumes.end() && --volumeIt->second.refCount > 0)
+        return;
+    if (volumeIt != _sharedVolumes.end())
+        _sharedVolumes.erase(volumeIt);
+    _sharedVolumeKeys.erase(keyIt);
+    DestroyArnoldNode(volume);
+}
+
+HdArnoldNodeGraph* HdArnoldRenderDelegate::AcquireMaterialNetwork(size_t hash, HdArnoldNodeGraph* nodeGraph)
+{
+    std::unique_lock<std::shared_timed_mutex> lock(_materialNetworksMutex);
+    auto it = _materialNetworks.emplace(hash, nodeGraph).first;
+    return it->second;
+}
+
+HdArnoldNodeGraph* HdArnoldRenderDelegate::GetMaterialNetwork(size_t hash) const
+{
+    std::shared_lock<std::shared_timed_mutex> lock(_materialNetworksMutex);
+    const auto it = _materialNetworks.find(hash);
+    return it == _materialNetworks.end() ? nullptr : it->second;
+}
+
+void HdArnoldRenderDelegate::ReleaseMaterialNetwork(size_t hash, const HdArnoldNodeGraph* nodeGraph)
+{
+    std::unique_lock<std::shared_timed_mutex> lock(_materialNetworksMutex);
+    const auto it = _materialNetworks.find(hash);
+    if (it != _materialNetworks.end() && it->second == nodeGraph)
+        _materialNetworks.erase(it);
+}
+
 HdAovDescriptor HdArnoldRenderDelegate::GetDefaultAovDescriptor(const TfToken& name) const
 {
     if (name == HdAovTokens->color) {
@@ -1799,36 +1909,36 @@ bool HdArnoldRenderDelegate::HasPendingChanges(HdRenderIndex* renderIndex, const
         // the dirty notifications get discarded. We have to use a workaround to get the same behaviour as before by propagating the dirtyness to a dedicated scene index filter.
         if (HdRenderIndex::IsSceneIndexEmulationEnabled()) {
             if (HdSceneIndexBaseRefPtr sceneIndex = renderIndex->GetTerminalSceneIndex()) {
-                // Regarding the used of TfHashMap to carry the dirtyness, we unfortunately can't pass
-                // directly HdSceneIndexObserver::DirtiedPrimEntries due to template functions implementation
-                // missing for this type. Vectors of SdfPath and HdDataSourceLocatorSet don't work as well. So
-                // we revert to an hashmap which it not ideal, but it allows us to decouple the libraries using
-                // only available functions and supported types known by each libs.
-                TfHashMap<SdfPath, HdDataSourceLocatorSet, SdfPath::Hash> dirtyEntries;
-                for (const SdfPath& id : renderIndex->GetRprimIds()) {
-                    HdSceneIndexPrim prim = sceneIndex->GetPrim(id);
+                // Rather than listing every rprim, we only send the locators to dirty for each rprim type.
+                // The PropagateDirtyPrimsSceneIndex keeps track of the prims of each type, so neither the
+                // message nor the lookup depends on the size of the scene.
+                TfTokenVector primTypes;
+                std::vector<HdDataSourceBaseHandle> primTypeLocators;
+                for (const TfToken& primType : _supportedRprimTypes) {
                     HdDataSourceLocatorSet locators;
                     // TODO: We might have to also translate bespoke arnold nodes parameters if they are not supported.
-                    HdDirtyBitsTranslator::RprimDirtyBitsToLocatorSet(prim.primType, bits, &locators);
+                    HdDirtyBitsTranslator::RprimDirtyBitsToLocatorSet(primType, bits, &locators);
                     if (!locators.IsEmpty()) {
-                        dirtyEntries.insert({id, locators});
+                        primTypes.push_back(primType);
+                        primTypeLocators.push_back(
+                            HdRetainedTypedSampledDataSource<HdDataSourceLocatorSet>::New(locators));
                     }
                 }
+                if (!primTypes.empty()) {
+                    sceneIndex->SystemMessage(
+                        str::t_ArnoldMarkRprimTypesDirty,
+                        HdRetainedContainerDataSource::New(
+                            primTypes.size(), primTypes.data(), primTypeLocators.data()));
+                }
                 // if the shutter was modified, we also want to update the camera
                 if (bits & HdChangeTracker::DirtyTransform && !cameraId.IsEmpty()) {
                     HdSceneIndexPrim prim = sceneIndex->GetPrim(cameraId);
                     HdDataSourceLocatorSet locators;
                     HdDirtyBitsTranslator::SprimDirtyBitsToLocatorSet(prim.primType, HdCamera::AllDirty, &locators);
                     if (!locators.IsEmpty()) {
-                        dirtyEntries.insert({cameraId, locators});
+                        _MarkPrimsDirty(sceneIndex, {{cameraId, locators}});
                     }
                 }
-
-                if (!dirtyEntries.empty()) {
-                    auto dataSource = HdRetainedTypedSampledDataSource<
-                        TfHashMap<SdfPath, HdDataSourceLocatorSet, SdfPath::Hash>>::New(dirtyEntries);
-                    sceneIndex->SystemMessage(str::t_ArnoldMarkPrimsDirty, dataSource);
-                }
             }
         } else {
             renderIndex->GetChangeTracker().MarkAllRprimsDirty(bits);
@@ -1862,11 +1972,7 @@ bool HdArnoldRenderDelegate::HasPendingChanges(HdRenderIndex* renderIndex, const
                 HdDirtyBitsTranslator::SprimDirtyBitsToLocatorSet(prim.primType, bits, &locators);
             }
             if (!locators.IsEmpty()) {
-                TfHashMap<SdfPath, HdDataSourceLocatorSet, SdfPath::Hash> dirtyEntries;
-                dirtyEntries.insert({source, locators});
-                auto dataSource = HdRetainedTypedSampledDataSource<
-                    TfHashMap<SdfPath, HdDataSourceLocatorSet, SdfPath::Hash>>::New(dirtyEntries);
-                terminalSceneIndex->SystemMessage(str::t_ArnoldMarkPrimsDirty, dataSource);
+                _MarkPrimsDirty(terminalSceneIndex, {{source, locators}});
             }
             return;
         }
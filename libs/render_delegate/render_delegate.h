@@ -46,7 +46,9 @@
 #include <pxr/imaging/hgi/hgi.h>
 
 #include <tbb/concurrent_queue.h>
+#include <atomic>
 #include <functional>
+#include <shared_mutex>
 #include "hdarnold.h"
 #include "render_param.h"
 #include "api_adapter.h"
@@ -58,6 +60,7 @@ class HydraArnoldReader;
 
 PXR_NAMESPACE_OPEN_SCOPE
 class HdArnoldRenderBuffer;
+class HdArnoldNodeGraph;
 struct HdArnoldRenderVar {
     /// Settings for the RenderVar.
     HdAovSettingsMap settings;
@@ -546,6 +549,10 @@ public:
     HDARNOLD_API
     void ClearCryptomatteDrivers();
 
+    /// Count a render restart caused by a change of the outputs (AOV bindings, render products
+    /// or imagers). The total is reported as "aovRestarts" in the render stats.
+    void CountAovRestart() { _aovRestarts++; }
+
     /// Get the current Window NDC, as a resolution-independant value, 
     /// defaulting to (0,0,1,1)
     ///
@@ -736,6 +743,44 @@ public:
         _meshLightsChanged.store(true, std::memory_order_release);
     }
 
+    /// Returns the hidden volume node loading the given grids from a vdb file, and creates it
+    /// if needed. Volume prims point to it through ginstances, so that each vdb file
+    /// is loaded only once no matter how many prims reference it.
+    /// Every call must be balanced by a call to ReleaseSharedVolume.
+    ///
+    /// @param filename Resolved path of the vdb file.
+    /// @param grids Grids to load from the file, in the format of the volume node.
+    /// @return Pointer to the shared volume node.
+    HDARNOLD_API
+    AtNode* AcquireSharedVolume(const std::string& filename, const std::vector<std::string>& grids);
+
+    /// Releases a volume node returned by AcquireSharedVolume,
+    /// and destroys it when it's not referenced anymore.
+    ///
+    /// @param volume Pointer to the shared volume node.
+    HDARNOLD_API
+    void ReleaseSharedVolume(AtNode* volume);
+
+    /// Returns the node graph translating the material networks with the given content hash.
+    /// The first node graph registering a hash translates it, the following ones use its shaders.
+    ///
+    /// @param hash Content hash of the material network map (see HdArnoldNodeGraph).
+    /// @param nodeGraph Node graph registered for the hash if there is none yet.
+    /// @return Pointer to the node graph translating this hash.
+    HDARNOLD_API
+    HdArnoldNodeGraph* AcquireMaterialNetwork(size_t hash, HdArnoldNodeGraph* nodeGraph);
+
+    /// Returns the node graph registered for a material network hash, or nullptr.
+    HDARNOLD_API
+    HdArnoldNodeGraph* GetMaterialNetwork(size_t hash) const;
+
+    /// Unregister a node graph previously returned by AcquireMaterialNetwork for itself.
+    ///
+    /// @param hash Content hash the node graph was registered with.
+    /// @param nodeGraph Node graph to unregister.
+    HDARNOLD_API
+    void ReleaseMaterialNetwork(size_t hash, const HdArnoldNodeGraph* nodeGraph);
+
     /// Register a coordinate-system projection camera together with its aperture
     /// ratio (verticalAperture / horizontalAperture). The vertical screen window
     /// of these cameras is (re)computed from the actual render resolution in
@@ -879,6 +924,19 @@ private:
     std::mutex _coordSysCamerasMutex;
     std::unordered_map<AtNode*, float> _coordSysCameras; ///< coordSys camera node -> aperture ratio (vAp/hAp)
 
+    struct SharedVolume {
+        AtNode* node = nullptr;
+        int refCount = 0;
+    };
+    std::mutex _sharedVolumesMutex;
+    std::unordered_map<std::string, SharedVolume> _sharedVolumes; ///< vdb file and grids -> shared volume node
+    std::unordered_map<const AtNode*, std::string> _sharedVolumeKeys;
+    unsigned int _sharedVolumeCount = 0;
+
+    /// Node graphs are read from the parallel rprim sync to resolve shared networks
+    mutable std::shared_timed_mutex _materialNetworksMutex;
+    std::unordered_map<size_t, HdArnoldNodeGraph*> _materialNetworks; ///< Content hash -> translating node graph
+
     /// FPS value from render settings.
     float _fps;
     // window used for overscan or to adjust the camera frustum
@@ -895,6 +953,7 @@ private:
     std::string _outputOverride;
     int _mask = AI_NODE_ALL;  // mask for node types to be translated
     bool _hasCryptomatte = false;
+    std::atomic<size_t> _aovRestarts{0}; ///< Number of render restarts caused by output changes.
     std::mutex _nodesMutex;
     mutable std::mutex _nodeNamesMutex;
     bool _renderDelegateOwnsUniverse;
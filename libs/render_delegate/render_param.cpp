@@ -30,6 +30,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "render_param.h"
+#include "config.h"
 #include "render_delegate.h"
 #include <constant_strings.h>
 #include <pxr/base/tf/debug.h>
@@ -73,6 +74,10 @@ HdArnoldRenderParam::HdArnoldRenderParam(HdArnoldRenderDelegate* delegate) : _de
     // If the HDARNOLD_DEBUG_SCENE env variable is defined, we'll want to 
     // save out the scene every time it's about to be rendered
     _debugScene = TfGetEnvSetting(HDARNOLD_DEBUG_SCENE);
+
+    _adaptiveMinAASamples = HdArnoldConfig::GetInstance().progressive_adaptive_min_AA_samples;
+    _userMinAASamples = HdArnoldConfig::GetInstance().progressive_min_AA_samples;
+    _scheduledMinAASamples.store(_userMinAASamples, std::memory_order_release);
 }
 
 HdArnoldRenderParam::Status HdArnoldRenderParam::UpdateRender()
@@ -136,6 +141,7 @@ HdArnoldRenderParam::Status HdArnoldRenderParam::UpdateRender()
                 // usually precedes it, so the pause is no longer in effect -- clear it instead of leaving a stale
                 // flag behind (there is nothing left to unpause: the gated threads are long gone).
                 _paused.store(false, std::memory_order_release);
+                _ScheduleProgressiveMinAASamples();
                 if (!_debugScene.empty())
                     WriteDebugScene();
                 AiRenderRestart(_delegate->GetRenderSession());
@@ -160,6 +166,7 @@ HdArnoldRenderParam::Status HdArnoldRenderParam::UpdateRender()
                 return Status::Converging;
             }
             if (needsRestart) {
+                _ScheduleProgressiveMinAASamples();
                 if (!_debugScene.empty())
                     WriteDebugScene();
                 AiRenderRestart(_delegate->GetRenderSession());
@@ -362,6 +369,64 @@ void HdArnoldRenderParam::WriteDebugScene() const
     }
 }
 
+void HdArnoldRenderParam::NotifyBucketWritten()
+{
+    // Cheap check first, this is called by every render thread for every bucket
+    if (!_waitingFirstBucket.load(std::memory_order_acquire))
+        return;
+    if (_waitingFirstBucket.exchange(false, std::memory_order_acq_rel))
+        _firstPixelLatency.store(GetElapsedRenderTime(), std::memory_order_release);
+}
+
+void HdArnoldRenderParam::SetDirtyRegions(VtDictionary&& dirtyRegions)
+{
+    std::lock_guard<std::mutex> guard(_dirtyRegionsMutex);
+    _dirtyRegions = std::move(dirtyRegions);
+}
+
+VtDictionary HdArnoldRenderParam::GetDirtyRegions() const
+{
+    std::lock_guard<std::mutex> guard(_dirtyRegionsMutex);
+    return _dirtyRegions;
+}
+
+void HdArnoldRenderParam::_ScheduleProgressiveMinAASamples()
+{
+    if (!_adaptiveMinAASamples || _delegate->IsBatchContext())
+        return;
+    AtRenderSession* renderSession = _delegate->GetRenderSession();
+    bool progressive = false;
+    AiRenderGetHintBool(renderSession, str::progressive, progressive);
+    float targetFps = 0.f;
+    AiRenderGetHintFlt(renderSession, str::interactive_target_fps, targetFps);
+    if (!progressive || targetFps <= 0.f)
+        return;
+
+    int minAASamples = _scheduledMinAASamples.load(std::memory_order_acquire);
+    int currentMinAASamples = minAASamples;
+    AiRenderGetHintInt(renderSession, str::progressive_min_AA_samples, currentMinAASamples);
+    if (currentMinAASamples != minAASamples) {
+        // The render setting was changed since our last decision, start again from the new value.
+        _userMinAASamples = currentMinAASamples;
+        minAASamples = currentMinAASamples;
+    }
+
+    const double latency = _firstPixelLatency.load(std::memory_order_acquire);
+    if (latency >= 0.0) {
+        // Negative values render downscaled passes, we stop at a single sample per 8x8 pixels.
+        constexpr int lowestMinAASamples = -8;
+        const double targetLatency = 1000.0 / targetFps;
+        if (latency > targetLatency * 2.0 && minAASamples > lowestMinAASamples) {
+            minAASamples--;
+        } else if (latency < targetLatency * 0.25 && minAASamples < _userMinAASamples) {
+            minAASamples++;
+        }
+    }
+    if (minAASamples != currentMinAASamples)
+        AiRenderSetHintInt(renderSession, str::progressive_min_AA_samples, minAASamples);
+    _scheduledMinAASamples.store(minAASamples, std::memory_order_release);
+}
+
 double HdArnoldRenderParam::GetElapsedRenderTime() const
 {
     std::chrono::time_point<std::chrono::system_clock> t0;
@@ -39,6 +39,7 @@
 #include <pxr/pxr.h>
 
 #include <pxr/base/gf/vec2f.h>
+#include <pxr/base/vt/dictionary.h>
 
 #include <pxr/imaging/hd/renderDelegate.h>
 
@@ -46,6 +47,7 @@
 
 #include "hdarnold.h"
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 
@@ -177,6 +179,34 @@ public:
     /// @return elapsed render time in ms
     double GetElapsedRenderTime() const;
 
+    /// Called by the main driver for every bucket it receives, to measure the time it took to get
+    /// the first pixels since the render was (re)started. This is thread safe.
+    HDARNOLD_API
+    void NotifyBucketWritten();
+
+    /// Returns the time between the last (re)start of the render and its first bucket.
+    ///
+    /// @return latency in ms, or a negative value if no bucket was received yet.
+    double GetFirstPixelLatency() const { return _firstPixelLatency.load(std::memory_order_acquire); }
+
+    /// Returns true if the minimum AA samples of the progressive passes are adapted to the first pixel latency.
+    bool IsProgressiveMinAASamplesAdaptive() const { return _adaptiveMinAASamples; }
+
+    /// Returns the minimum AA samples of the progressive passes picked for the last restart.
+    int GetScheduledProgressiveMinAASamples() const { return _scheduledMinAASamples.load(std::memory_order_acquire); }
+
+    /// Stores the dirty regions of the render buffers last published by the render pass, for the render stats.
+    ///
+    /// @param dirtyRegions Dictionary with an entry for each AOV.
+    HDARNOLD_API
+    void SetDirtyRegions(VtDictionary&& dirtyRegions);
+
+    /// Returns the dirty regions of the render buffers last published by the render pass.
+    ///
+    /// @return Dictionary with an entry for each AOV, empty if nothing was published.
+    HDARNOLD_API
+    VtDictionary GetDirtyRegions() const;
+
     /// Returns the latest render error code.
     ///
     /// @return error code.
@@ -203,8 +233,16 @@ private:
         // protected by _renderTimeMutex if an exception escaped.
         std::lock_guard<std::mutex> guard(_renderTimeMutex);
         _renderStartTime = std::chrono::system_clock::now();
+        _waitingFirstBucket.store(true, std::memory_order_release);
     }
 
+    /// Picks the minimum AA samples of the progressive passes before restarting the render, so the
+    /// first pixels are displayed within the interactive target frame time.
+    ///
+    /// The level is lowered when the first pixels of the previous render took more than twice the
+    /// target time, and raised back when they took less than a quarter of it.
+    void _ScheduleProgressiveMinAASamples();
+
     /// The render delegate
     const HdArnoldRenderDelegate* _delegate;
     /// Indicate if render needs restarting, in case interrupt is called after rendering has finished.
@@ -247,6 +285,19 @@ private:
     AtRenderErrorCode _errorCode = AI_SUCCESS;
     /// Path to the driving hydra render settings prim.
     SdfPath _hydraRenderSettingsPrimPath;
+    /// True until the main driver receives the first bucket after a (re)start.
+    std::atomic<bool> _waitingFirstBucket{false};
+    /// Time between the last (re)start and the first bucket, in ms.
+    std::atomic<double> _firstPixelLatency{-1.0};
+    /// Adapt the progressive min AA samples to the first pixel latency.
+    bool _adaptiveMinAASamples = false;
+    /// Progressive min AA samples set for the last restart.
+    std::atomic<int> _scheduledMinAASamples{0};
+    /// Progressive min AA samples set by the user, the scheduler never goes above it.
+    int _userMinAASamples = 0;
+    /// Dirty regions of the render buffers published by the render pass, read by the render stats.
+    VtDictionary _dirtyRegions;
+    mutable std::mutex _dirtyRegionsMutex;
 };
 
 class HdArnoldRenderParamInterrupt {
@@ -101,6 +101,9 @@ TF_DEFINE_PRIVATE_TOKENS(_tokens,
     (color2i8) (color3i8) (color4i8)
     (int2)
     (uint) (uint2) (uint3) (uint4)
+    // Entries of the dirty regions reported in the render stats
+    (region)
+    (version)
 );
 // clang-format on
 
@@ -220,7 +223,7 @@ void _ReadNodeParameters(AtNode* node, const TfToken& prefix, const HdAovSetting
     }
 };
 
-AtNode* _CreateFilter(HdArnoldRenderDelegate* renderDelegate, const HdAovSettingsMap& aovSettings, int filterIndex)
+AtNode* _CreateFilter(HdArnoldRenderDelegate* renderDelegate, const HdAovSettingsMap& aovSettings, const std::string& filterName)
 {
     // We need to make sure that it's holding a string, then try to create it to make sure
     // it's a node type supported by Arnold.
@@ -228,8 +231,7 @@ AtNode* _CreateFilter(HdArnoldRenderDelegate* renderDelegate, const HdAovSetting
     if (filterType.empty()) {
         return nullptr;
     }
-    const auto filterNameStr =
-        renderDelegate->GetLocalNodeName(AtString{TfStringPrintf("HdArnoldRenderPass_filter_%d", filterIndex).c_str()});
+    const auto filterNameStr = renderDelegate->GetLocalNodeName(AtString{filterName.c_str()});
 
     AtNode* filter = renderDelegate->FindOrCreateArnoldNode(AtString(filterType.c_str()), filterNameStr);
     if (filter == nullptr) {
@@ -247,6 +249,11 @@ AtNode* _CreateFilter(HdArnoldRenderDelegate* renderDelegate, const HdAovSetting
     return filter;
 }
 
+AtNode* _CreateFilter(HdArnoldRenderDelegate* renderDelegate, const HdAovSettingsMap& aovSettings, int filterIndex)
+{
+    return _CreateFilter(renderDelegate, aovSettings, TfStringPrintf("HdArnoldRenderPass_filter_%d", filterIndex));
+}
+
 void _DisableBlendOpacity(AtNode* node)
 {
     if (AiNodeEntryLookUpParameter(AiNodeGetNodeEntry(node), str::blend_opacity) != nullptr) {
@@ -455,6 +462,8 @@ HdArnoldRenderPass::HdArnoldRenderPass(
     
     _mainDriver = _renderDelegate->CreateArnoldNode(str::HdArnoldDriverMain,
         _renderDelegate->GetLocalNodeName(str::renderPassMainDriver));
+    AiNodeSetPtr(_mainDriver, str::render_param_pointer,
+        static_cast<HdArnoldRenderParam*>(_renderDelegate->GetRenderParam()));
     _primIdWriter = _renderDelegate->CreateArnoldNode(str::aov_write_int,
         _renderDelegate->GetLocalNodeName(str::renderPassPrimIdWriter));
     
@@ -950,10 +959,16 @@ void HdArnoldRenderPass::_Execute(const HdRenderPassStateSharedPtr& renderPassSt
         updateAovs || updateImagers) {
         
         renderParam->Interrupt();
+        // Changing the outputs always requires a restart, we count them to keep track of the interactive cost
+        _renderDelegate->CountAovRestart();
         if (_mainDriver)
             AiNodeResetParameter(_mainDriver, str::render_outputs);
 
-        _ClearRenderBuffers();
+        // The filters and shaders of the bindings that didn't change are kept, the previous buffers
+        // are only used to look them up and destroy the ones that are not needed anymore.
+        HdArnoldRenderBufferStorage previousRenderBuffers;
+        previousRenderBuffers.swap(_renderBuffers);
+        _ClearRenderOutputs();
         _renderDelegate->ClearCryptomatteDrivers();
         AiNodeSetPtr(_mainDriver, str::color_pointer, nullptr);
         AiNodeSetPtr(_mainDriver, str::depth_pointer, nullptr);
@@ -992,7 +1007,24 @@ void HdArnoldRenderPass::_Execute(const HdRenderPassStateSharedPtr& renderPassSt
             // while they are being used.
             buffer.buffer = dynamic_cast<HdArnoldRenderBuffer*>(binding.renderBuffer);
             buffer.settings = binding.aovSettings;
-            buffer.filter = _CreateFilter(_renderDelegate, binding.aovSettings, ++filterIndex);
+            const auto previousBuffer = previousRenderBuffers.find(binding.aovName);
+            if (previousBuffer != previousRenderBuffers.end()) {
+                if (previousBuffer->second.settings == binding.aovSettings) {
+                    std::swap(buffer.filter, previousBuffer->second.filter);
+                    std::swap(buffer.writer, previousBuffer->second.writer);
+                    std::swap(buffer.reader, previousBuffer->second.reader);
+                }
+                // The nodes are looked up by name, so the ones that can't be reused are destroyed before
+                // creating the new ones.
+                _DestroyRenderBufferNodes(previousBuffer->second);
+                previousRenderBuffers.erase(previousBuffer);
+            }
+            // Filters are named after their AOV, so the ones we kept can't be found by another binding.
+            if (buffer.filter == nullptr) {
+                buffer.filter = _CreateFilter(
+                    _renderDelegate, binding.aovSettings,
+                    TfStringPrintf("HdArnoldRenderPass_aov_filter_%s", binding.aovName.GetText()));
+            }
             const auto* filterName = buffer.filter != nullptr ? AiNodeGetName(buffer.filter) : boxName;
             // Different possible filter for P and ID AOVs.
             const auto* filterGeoName = buffer.filter != nullptr ? AiNodeGetName(buffer.filter) : closestName;
@@ -1132,6 +1164,10 @@ void HdArnoldRenderPass::_Execute(const HdRenderPassStateSharedPtr& renderPassSt
             }
             outputs.push_back(output);
         }
+        // Destroy the nodes of the bindings that were removed
+        for (auto& previousBuffer : previousRenderBuffers) {
+            _DestroyRenderBufferNodes(previousBuffer.second);
+        }
         if (buffer_names.empty() || buffer_names.size() != buffer_pointers.size()) {
             AiNodeResetParameter(_mainDriver, str::buffer_names);
             AiNodeResetParameter(_mainDriver, str::buffer_pointers);
@@ -1508,11 +1544,40 @@ void HdArnoldRenderPass::_Execute(const HdRenderPassStateSharedPtr& renderPassSt
             }
             clearBuffers(_renderBuffers, false, abortWidth, abortHeight);
         }
+        // The buckets written by the driver are published to the hosts at the interactive target rate,
+        // coalesced per buffer, instead of every time we're called. The last buckets are always
+        // published once the render is done.
+        const auto now = std::chrono::steady_clock::now();
+        bool publishDirtyRegions = renderStatus != HdArnoldRenderParam::Status::Converging;
+        if (!publishDirtyRegions) {
+            float targetFps = 0.f;
+            AiRenderGetHintFlt(_renderDelegate->GetRenderSession(), str::interactive_target_fps, targetFps);
+            publishDirtyRegions =
+                targetFps <= 0.f || now - _lastDirtyRegionsPublish >= std::chrono::duration<float>(1.f / targetFps);
+        }
+        if (publishDirtyRegions)
+            _lastDirtyRegionsPublish = now;
+        VtDictionary dirtyRegions;
         for (auto& buffer : _renderBuffers) {
             if (buffer.second.buffer != nullptr) {
                 buffer.second.buffer->SetConverged(_isConverged);
+                if (publishDirtyRegions) {
+                    buffer.second.buffer->PublishDirtyRegion();
+                    const unsigned int version = buffer.second.buffer->GetDirtyRegionVersion();
+                    if (version == 0)
+                        continue;
+                    const auto region = buffer.second.buffer->GetDirtyRegion();
+                    VtDictionary entry;
+                    entry[_tokens->region] =
+                        VtValue(GfRect2i(GfVec2i(region.minX, region.minY), GfVec2i(region.maxX, region.maxY)));
+                    entry[_tokens->version] = VtValue(static_cast<int>(version));
+                    dirtyRegions[buffer.first.GetString()] = VtValue(entry);
+                }
             }
         }
+        // Hosts poll the regions with the render stats of the delegate
+        if (publishDirtyRegions)
+            renderParam->SetDirtyRegions(std::move(dirtyRegions));
     }
 }
 
@@ -1531,7 +1596,7 @@ bool HdArnoldRenderPass::_RenderBuffersChanged(const HdRenderPassAovBindingVecto
     return false;
 }
 
-void HdArnoldRenderPass::_ClearRenderBuffers()
+void HdArnoldRenderPass::_ClearRenderOutputs()
 {
 #if ARNOLD_VERSION_NUM >= 70405
     
@@ -1550,18 +1615,29 @@ void HdArnoldRenderPass::_ClearRenderBuffers()
         AiNodeIteratorDestroy(nodeIter);
     }
 #endif
+}
 
+void HdArnoldRenderPass::_DestroyRenderBufferNodes(HdArnoldRenderBuffer::BufferDefinition& buffer)
+{
+    if (buffer.filter != nullptr) {
+        _renderDelegate->DestroyArnoldNode(buffer.filter);
+        buffer.filter = nullptr;
+    }
+    if (buffer.writer != nullptr) {
+        _renderDelegate->DestroyArnoldNode(buffer.writer);
+        buffer.writer = nullptr;
+    }
+    if (buffer.reader != nullptr) {
+        _renderDelegate->DestroyArnoldNode(buffer.reader);
+        buffer.reader = nullptr;
+    }
+}
 
+void HdArnoldRenderPass::_ClearRenderBuffers()
+{
+    _ClearRenderOutputs();
     for (auto& buffer : _renderBuffers) {
-        if (buffer.second.filter != nullptr) {
-            _renderDelegate->DestroyArnoldNode(buffer.second.filter);
-        }
-        if (buffer.second.writer != nullptr) {
-            _renderDelegate->DestroyArnoldNode(buffer.second.writer);
-        }
-        if (buffer.second.reader != nullptr) {
-            _renderDelegate->DestroyArnoldNode(buffer.second.reader);
-        }
+        _DestroyRenderBufferNodes(buffer.second);
     }
     decltype(_renderBuffers){}.swap(_renderBuffers);
 }
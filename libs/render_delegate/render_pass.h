@@ -48,6 +48,8 @@
 
 #include <ai.h>
 
+#include <chrono>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdArnoldRenderSettings;
@@ -93,6 +95,16 @@ protected:
     HDARNOLD_API
     void _ClearRenderBuffers();
 
+    /// Destroys the render outputs created by Arnold from the outputs strings.
+    HDARNOLD_API
+    void _ClearRenderOutputs();
+
+    /// Destroys the filter, writer and reader assigned to a render buffer.
+    ///
+    /// \param buffer Render buffer definition holding the nodes.
+    HDARNOLD_API
+    void _DestroyRenderBufferNodes(HdArnoldRenderBuffer::BufferDefinition& buffer);
+
 #if PXR_VERSION >= 2308
     /// Gets the driving hydra render settings prim.
     ///
@@ -152,6 +164,9 @@ private:
     // Window NDC region, that can be used for overscan, or to adjust the frustum
     GfVec4f _windowNDC =  GfVec4f(0.f, 0.f, 1.f, 1.f);
 
+    /// Last time the dirty regions of the render buffers were published.
+    std::chrono::steady_clock::time_point _lastDirtyRegionsPublish;
+
     bool _acceleratedViewport = false;
     bool _isConverged = false;          ///< State of the render convergence.
 };
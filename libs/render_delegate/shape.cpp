@@ -199,11 +199,16 @@ void HdArnoldShape::_SyncInstances(
     param.Interrupt();
 
     if (UseArnoldInstancer(sceneDelegate, _renderDelegate, instancer, _shape)) {
-        // First destroy the arnold parent instancers to this mesh
-        for (auto &instancerNode : _instancers) {
-            _renderDelegate->DestroyArnoldNode(instancerNode);
-        }
-        _instancers.clear();
+        // The arnold parent instancers to this mesh are kept aside, so the ones that are still
+        // part of the chain are updated in place instead of being recreated.
+        std::vector<AtNode*> previousInstancers;
+        previousInstancers.swap(_instancers);
+        auto destroyPreviousInstancers = [&]() {
+            for (auto *instancerNode : previousInstancers) {
+                if (instancerNode != nullptr)
+                    _renderDelegate->DestroyArnoldNode(instancerNode);
+            }
+        };
 
         // We need to hide the source mesh.
         AiNodeSetByte(_shape, str::visibility, 0);
@@ -212,9 +217,13 @@ void HdArnoldShape::_SyncInstances(
         // GetInstancer can return a non-HdArnoldInstancer or null, so use dynamic_cast and bail safely.
         auto& renderIndex = sceneDelegate->GetRenderIndex();
         auto* hydraInstancer = dynamic_cast<HdArnoldInstancer*>(renderIndex.GetInstancer(instancerId));
-        if (hydraInstancer == nullptr)
+        if (hydraInstancer == nullptr) {
+            destroyPreviousInstancers();
             return;
-        hydraInstancer->CreateArnoldInstancer(renderDelegate, id, _instancers);
+        }
+        hydraInstancer->CreateArnoldInstancer(renderDelegate, id, _instancers, &previousInstancers);
+        // Destroy the instancers that are not part of the new chain
+        destroyPreviousInstancers();
 
         const TfToken renderTag = sceneDelegate->GetRenderTag(id);
 
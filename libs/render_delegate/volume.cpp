@@ -42,6 +42,8 @@
 #include <pxr/usd/usdVol/tokens.h>
 
 #include <constant_strings.h>
+#include <profile_utils.h>
+#include "config.h"
 #include "coord_sys.h"
 #include "node_graph.h"
 #include "openvdb_asset.h"
@@ -183,6 +185,16 @@ struct VdbFieldData {
     int fieldIndex = 0;
 };
 
+// Returns the volume node loading the vdb file, either the shape itself
+// or the shared volume it is an instance of.
+const AtNode* _GetVolumeNode(const HdArnoldShape* shape)
+{
+    const AtNode* node = shape->GetShape();
+    if (node != nullptr && AiNodeIs(node, str::ginstance))
+        return static_cast<const AtNode*>(AiNodeGetPtr(node, str::node));
+    return node;
+}
+
 
 } // namespace
 
@@ -204,13 +216,14 @@ HdArnoldVolume::~HdArnoldVolume()
 {
     // Stop tracking dependencies for this prim
     _renderDelegate->ClearDependencies(GetId());
-    _ForEachVolume([](HdArnoldShape* s) { delete s; });
+    _ForEachVolume([this](HdArnoldShape* s) { _DeleteVolume(s); });
 }
 
 void HdArnoldVolume::Sync(
     HdSceneDelegate* sceneDelegate, HdRenderParam* renderParam, HdDirtyBits* dirtyBits, const TfToken& reprToken)
 {
     AiProfileBlock("hydra_proc:HdArnoldVolume:Sync");
+    ArnoldUsdProfileScope profileScope("sync", "HdArnoldVolume");
     TRACE_FUNCTION();
     if (!_renderDelegate->CanUpdateScene())
         return;
@@ -218,11 +231,24 @@ void HdArnoldVolume::Sync(
     TF_UNUSED(reprToken);
     HdArnoldRenderParamInterrupt param(renderParam);
     const auto& id = GetId();
+    // Newer USD versions need to update the instancer before accessing the instancer id.
+    _UpdateInstancer(sceneDelegate, dirtyBits);
+
     auto volumesChanged = false;
-    if (HdChangeTracker::IsTopologyDirty(*dirtyBits, id)) {
-        param.Interrupt();
-        _CreateVolumes(id, sceneDelegate);
-        volumesChanged = true;
+    const bool topologyDirty = HdChangeTracker::IsTopologyDirty(*dirtyBits, id);
+    if (topologyDirty || (*dirtyBits & (HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyInstancer))) {
+        const bool shareVolumes = _CanShareVolumes(id, sceneDelegate);
+        if (topologyDirty || shareVolumes != _shareVolumes) {
+            if (shareVolumes != _shareVolumes) {
+                // The volumes are replaced by different nodes, all their parameters must be set again
+                *dirtyBits |= HdChangeTracker::DirtyTransform | HdChangeTracker::DirtyVisibility |
+                              HdChangeTracker::DirtyDoubleSided | HdChangeTracker::DirtyPrimvar;
+                _shareVolumes = shareVolumes;
+            }
+            param.Interrupt();
+            _CreateVolumes(id, sceneDelegate);
+            volumesChanged = true;
+        }
     }
 
     // DirtyCategories carries the coordinate-system bindings, and the material's
@@ -290,8 +316,6 @@ void HdArnoldVolume::Sync(
         });
     }
 
-    // Newer USD versions need to update the instancer before accessing the instancer id.
-    _UpdateInstancer(sceneDelegate, dirtyBits);
     // We also force syncing of the parent instancers.
     HdInstancer::_SyncInstancerAndParents(sceneDelegate->GetRenderIndex(), GetInstancerId());
 
@@ -357,10 +381,11 @@ void HdArnoldVolume::_CreateVolumes(const SdfPath& id, HdSceneDelegate* sceneDel
     _volumes.erase(
         std::remove_if(
             _volumes.begin(), _volumes.end(),
-            [&openvdb_fields](HdArnoldShape* shape) -> bool {
-                if (openvdb_fields.find(AiNodeGetStr(shape->GetShape(), str::filename).c_str()) ==
-                    openvdb_fields.end()) {
-                    delete shape;
+            [&](HdArnoldShape* shape) -> bool {
+                const AtNode* volume = _GetVolumeNode(shape);
+                if (volume == nullptr || AiNodeIs(shape->GetShape(), str::ginstance) != _shareVolumes ||
+                    openvdb_fields.find(AiNodeGetStr(volume, str::filename).c_str()) == openvdb_fields.end()) {
+                    _DeleteVolume(shape);
                     return true;
                 }
                 return false;
@@ -368,15 +393,44 @@ void HdArnoldVolume::_CreateVolumes(const SdfPath& id, HdSceneDelegate* sceneDel
         _volumes.end());
 
     for (const auto& openvdb : openvdb_fields) {
-
-        AtNode* volume = nullptr;
+        HdArnoldShape* volumeShape = nullptr;
         for (auto* shape : _volumes) {
-            auto* v = shape->GetShape();
-            if (openvdb.first == AiNodeGetStr(v, str::filename).c_str()) {
-                volume = v;
+            if (openvdb.first == AiNodeGetStr(_GetVolumeNode(shape), str::filename).c_str()) {
+                volumeShape = shape;
                 break;
             }
         }
+
+        const auto numFields = openvdb.second.size();
+        std::vector<std::string> grids;
+        grids.reserve(numFields);
+        for (const auto& fieldData : openvdb.second) {
+            grids.push_back(fieldData.field.GetString() + "[" + std::to_string(fieldData.fieldIndex) + "]");
+        }
+
+        if (_shareVolumes) {
+            // Volume prims reading the same grids, like the placements of a cloud, are ginstances
+            // of the same volume node, so that the vdb file is loaded only once.
+            AtNode* sharedVolume = _renderDelegate->AcquireSharedVolume(openvdb.first, grids);
+            AtNode* previousVolume = nullptr;
+            if (volumeShape == nullptr) {
+                volumeShape = new HdArnoldShape(str::ginstance, _renderDelegate, id, GetPrimId());
+                auto* ginstance = volumeShape->GetShape();
+                AiNodeSetStr(ginstance, str::name, AtString(TfStringPrintf("%s_p_%p", id.GetText(), ginstance).c_str()));
+                AiNodeSetBool(ginstance, str::inherit_xform, false);
+                _volumes.push_back(volumeShape);
+            } else {
+                previousVolume = static_cast<AtNode*>(AiNodeGetPtr(volumeShape->GetShape(), str::node));
+            }
+            AiNodeSetPtr(volumeShape->GetShape(), str::node, sharedVolume);
+            // Released once the ginstance points to the new one, and after the new one was acquired,
+            // so that a shared volume that didn't change is kept alive
+            if (previousVolume != nullptr)
+                _renderDelegate->ReleaseSharedVolume(previousVolume);
+            continue;
+        }
+
+        AtNode* volume = volumeShape ? volumeShape->GetShape() : nullptr;
         if (volume == nullptr) {
             auto* shape = new HdArnoldShape(str::volume, _renderDelegate, id, GetPrimId());
             volume = shape->GetShape();
@@ -386,19 +440,15 @@ void HdArnoldVolume::_CreateVolumes(const SdfPath& id, HdSceneDelegate* sceneDel
             _volumes.push_back(shape);
         }
 
-        const auto numFields = openvdb.second.size();
         auto* fields = AiArrayAllocate(numFields, 1, AI_TYPE_STRING);
         for (auto i = decltype(numFields){0}; i < numFields; ++i) {
-            const int fieldIndex = openvdb.second[i].fieldIndex;
-            std::string fieldIndexName = openvdb.second[i].field.GetString();
-            fieldIndexName += std::string("[") + std::to_string(fieldIndex) + std::string("]");
-            AiArraySetStr(fields, i, AtString(fieldIndexName.c_str()));
+            AiArraySetStr(fields, i, AtString(grids[i].c_str()));
         }
         AiNodeSetArray(volume, str::grids, fields);
     }
 
     for (auto* volume : _inMemoryVolumes) {
-        delete volume;
+        _DeleteVolume(volume);
     }
     _inMemoryVolumes.clear();
 
@@ -441,6 +491,41 @@ void HdArnoldVolume::_CreateVolumes(const SdfPath& id, HdSceneDelegate* sceneDel
     }
 }
 
+bool HdArnoldVolume::_CanShareVolumes(const SdfPath& id, HdSceneDelegate* sceneDelegate) const
+{
+    if (!HdArnoldConfig::GetInstance().share_volumes || !GetInstancerId().IsEmpty()) {
+        return false;
+    }
+    const AtNodeEntry* volumeEntry = AiNodeEntryLookUp(str::volume);
+    const AtNodeEntry* ginstanceEntry = AiNodeEntryLookUp(str::ginstance);
+    for (const auto& primvar : sceneDelegate->GetPrimvarDescriptors(id, HdInterpolation::HdInterpolationConstant)) {
+        if (!TfStringStartsWith(primvar.name.GetString(), str::t_arnold_prefix.GetString())) {
+            continue;
+        }
+        // Parameters like step_size or volume_padding don't exist on a ginstance
+        const AtString paramName(primvar.name.GetText() + str::t_arnold_prefix.size());
+        if (AiNodeEntryLookUpParameter(volumeEntry, paramName) != nullptr &&
+            AiNodeEntryLookUpParameter(ginstanceEntry, paramName) == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void HdArnoldVolume::_DeleteVolume(HdArnoldShape* shape)
+{
+    const AtNode* node = shape->GetShape();
+    AtNode* sharedVolume = nullptr;
+    if (node != nullptr && AiNodeIs(node, str::ginstance)) {
+        sharedVolume = static_cast<AtNode*>(AiNodeGetPtr(node, str::node));
+    }
+    // The ginstance is destroyed first, so it never points to a destroyed shared volume
+    delete shape;
+    if (sharedVolume != nullptr) {
+        _renderDelegate->ReleaseSharedVolume(sharedVolume);
+    }
+}
+
 HdDirtyBits HdArnoldVolume::GetInitialDirtyBitsMask() const { return HdChangeTracker::AllDirty; }
 
 HdDirtyBits HdArnoldVolume::_PropagateDirtyBits(HdDirtyBits bits) const { return bits & HdChangeTracker::AllDirty; }
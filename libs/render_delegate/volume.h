@@ -112,6 +112,24 @@ protected:
     HDARNOLD_API
     void _CreateVolumes(const SdfPath& id, HdSceneDelegate* sceneDelegate);
 
+    /// Returns true if the volumes of this primitive can be ginstances of the
+    /// volume nodes shared through the render delegate.
+    ///
+    /// Instanced volumes and volumes setting parameters specific to the volume
+    /// node with arnold primitive variables need their own volume nodes.
+    ///
+    /// @param id Path to the Primitive.
+    /// @param sceneDelegate Pointer to the Scene Delegate.
+    /// @return True if the volume nodes can be shared.
+    HDARNOLD_API
+    bool _CanShareVolumes(const SdfPath& id, HdSceneDelegate* sceneDelegate) const;
+
+    /// Deletes a volume, and releases the shared volume node it points to.
+    ///
+    /// @param shape Pointer to the volume to delete.
+    HDARNOLD_API
+    void _DeleteVolume(HdArnoldShape* shape);
+
     /// Iterates through all available volumes and calls a function on each of them.
     ///
     /// @tparam F Generic type for the function.
@@ -132,6 +150,7 @@ protected:
     std::vector<HdArnoldShape*> _inMemoryVolumes;  ///< Vectoring storing all the Volumes for in-memory VDB storage.
     HdArnoldRayFlags _visibilityFlags{AI_RAY_ALL}; ///< Visibility of the shape.
     HdArnoldRayFlags _sidednessFlags{AI_RAY_SUBSURFACE}; ///< Sidedness of the shape.
+    bool _shareVolumes = false; ///< If the volumes are ginstances of shared volume nodes.
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
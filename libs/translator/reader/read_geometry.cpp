@@ -835,22 +835,9 @@ AtNode* UsdArnoldReadPoints::Read(const UsdPrim &prim, UsdArnoldReaderContext &c
         // Arnold gs_rotation expects 4 floats per splat as [x, y, z, w]
         UsdGeomPrimvar orientPv = primvarsAPI.GetPrimvar(TfToken("orient"));
         if (orientPv) {
-            VtArray<GfQuatf> orientations;
-            if (orientPv.Get(&orientations, frame) && !orientations.empty()) {
-                const size_t n = orientations.size();
-                AtArray* rotArray = AiArrayAllocate(n * 4, 1, AI_TYPE_FLOAT);
-                float* out = static_cast<float*>(AiArrayMap(rotArray));
-                for (size_t i = 0; i < n; ++i) {
-                    const GfVec3f& imag = orientations[i].GetImaginary();
-                    const float    w    = orientations[i].GetReal();
-                    out[i * 4 + 0] = imag[0]; // x
-                    out[i * 4 + 1] = imag[1]; // y
-                    out[i * 4 + 2] = imag[2]; // z
-                    out[i * 4 + 3] = w;        // w
-                }
-                AiArrayUnmap(rotArray);
-                AiNodeSetArray(node, str::gs_rotation, rotArray);
-            }
+            VtValue orientations;
+            if (orientPv.Get(&orientations, frame))
+                ArnoldUsdSetGaussianSplatRotations(node, orientations);
         }
 
         // Set gaussian_splat_shader if no material will be bound
@@ -906,160 +893,56 @@ AtNode* UsdArnoldReadGaussianSplat::Read(const UsdPrim &prim, UsdArnoldReaderCon
     // Enable gaussian splat mode
     AiNodeSetStr(node, str::mode, str::gaussian);
 
+    // The attributes are read as VtValues, since they can either be authored
+    // with float or half precision, and converted directly into Arnold arrays.
     // --- Positions ----------------------------------------------------------
     {
         UsdAttribute posAttr;
-        bool isFloat = gs.UsesFloatPositions(&posAttr);
-        if (posAttr) {
-            if (isFloat) {
-                VtArray<GfVec3f> positions;
-                if (posAttr.Get(&positions, frame) && !positions.empty()) {
-                    AiNodeSetArray(node, str::points,
-                        AiArrayConvert(positions.size(), 1, AI_TYPE_VECTOR, positions.cdata()));
-                }
-            } else {
-                VtArray<GfVec3h> positionsh;
-                if (posAttr.Get(&positionsh, frame) && !positionsh.empty()) {
-                    std::vector<GfVec3f> positions(positionsh.size());
-                    for (size_t i = 0; i < positionsh.size(); ++i)
-                        positions[i] = GfVec3f(positionsh[i]);
-                    AiNodeSetArray(node, str::points,
-                        AiArrayConvert(positions.size(), 1, AI_TYPE_VECTOR, positions.data()));
-                }
-            }
-        }
+        gs.UsesFloatPositions(&posAttr);
+        VtValue positions;
+        if (posAttr && posAttr.Get(&positions, frame))
+            ArnoldUsdSetGaussianSplatVectors(node, str::points, positions);
     }
 
     // --- Scales -------------------------------------------------------------
     {
         UsdAttribute scaleAttr;
-        bool isFloat = gs.UsesFloatScales(&scaleAttr);
-        if (scaleAttr) {
-            if (isFloat) {
-                VtArray<GfVec3f> scales;
-                if (scaleAttr.Get(&scales, frame) && !scales.empty()) {
-                    AiNodeSetArray(node, str::gs_scale,
-                        AiArrayConvert(scales.size(), 1, AI_TYPE_VECTOR, scales.cdata()));
-                }
-            } else {
-                VtArray<GfVec3h> scalesh;
-                if (scaleAttr.Get(&scalesh, frame) && !scalesh.empty()) {
-                    std::vector<GfVec3f> scales(scalesh.size());
-                    for (size_t i = 0; i < scalesh.size(); ++i)
-                        scales[i] = GfVec3f(scalesh[i]);
-                    AiNodeSetArray(node, str::gs_scale,
-                        AiArrayConvert(scales.size(), 1, AI_TYPE_VECTOR, scales.data()));
-                }
-            }
-        }
+        gs.UsesFloatScales(&scaleAttr);
+        VtValue scales;
+        if (scaleAttr && scaleAttr.Get(&scales, frame))
+            ArnoldUsdSetGaussianSplatVectors(node, str::gs_scale, scales);
     }
 
     // --- Orientations -------------------------------------------------------
     // Arnold gs_rotation stores 4 floats per point as [x, y, z, w].
-    // USD GfQuatf stores GetReal()=w and GetImaginary()=(x,y,z).
     {
         UsdAttribute orientAttr;
-        bool isFloat = gs.UsesFloatOrientations(&orientAttr);
-        if (orientAttr) {
-            VtArray<GfQuatf> orientations;
-            if (!isFloat) {
-                VtArray<GfQuath> orientationsh;
-                if (orientAttr.Get(&orientationsh, frame) && !orientationsh.empty()) {
-                    orientations.resize(orientationsh.size());
-                    for (size_t i = 0; i < orientationsh.size(); ++i)
-                        orientations[i] = GfQuatf(orientationsh[i]);
-                }
-            } else {
-                orientAttr.Get(&orientations, frame);
-            }
-            if (!orientations.empty()) {
-                size_t n = orientations.size();
-                AtArray *rotArray = AiArrayAllocate(n * 4, 1, AI_TYPE_FLOAT);
-                float *out = static_cast<float *>(AiArrayMap(rotArray));
-                for (size_t i = 0; i < n; ++i) {
-                    const GfVec3f &imag = orientations[i].GetImaginary();
-                    float w = orientations[i].GetReal();
-                    out[i * 4 + 0] = imag[0]; // x
-                    out[i * 4 + 1] = imag[1]; // y
-                    out[i * 4 + 2] = imag[2]; // z
-                    out[i * 4 + 3] = w;       // w
-                }
-                AiArrayUnmap(rotArray);
-                AiNodeSetArray(node, str::gs_rotation, rotArray);
-            }
-        }
+        gs.UsesFloatOrientations(&orientAttr);
+        VtValue orientations;
+        if (orientAttr && orientAttr.Get(&orientations, frame))
+            ArnoldUsdSetGaussianSplatRotations(node, orientations);
     }
 
     // --- Opacities ----------------------------------------------------------
     {
         UsdAttribute opAttr;
-        bool isFloat = gs.UsesFloatOpacities(&opAttr);
-        if (opAttr) {
-            if (isFloat) {
-                VtArray<float> opacities;
-                if (opAttr.Get(&opacities, frame) && !opacities.empty()) {
-                    AiNodeSetArray(node, str::gs_opacity,
-                        AiArrayConvert(opacities.size(), 1, AI_TYPE_FLOAT, opacities.cdata()));
-                }
-            } else {
-                VtArray<GfHalf> opacitiesh;
-                if (opAttr.Get(&opacitiesh, frame) && !opacitiesh.empty()) {
-                    std::vector<float> opacities(opacitiesh.size());
-                    for (size_t i = 0; i < opacitiesh.size(); ++i)
-                        opacities[i] = static_cast<float>(opacitiesh[i]);
-                    AiNodeSetArray(node, str::gs_opacity,
-                        AiArrayConvert(opacities.size(), 1, AI_TYPE_FLOAT, opacities.data()));
-                }
-            }
-        }
+        gs.UsesFloatOpacities(&opAttr);
+        VtValue opacities;
+        if (opAttr && opAttr.Get(&opacities, frame))
+            ArnoldUsdSetGaussianSplatOpacities(node, opacities);
     }
 
     // --- Spherical harmonics coefficients -----------------------------------
-    // Arnold's gaussianEvalSh expects the DC SH coefficient (index 0 per
-    // particle) pre-stored as (raw_f_dc * C0 + 0.5), where
-    // C0 = 0.28209479177387814 (the l=0 SH basis constant).
-    // USD radiance:sphericalHarmonicsCoefficients stores raw coefficients;
-    // apply the transformation here before building the Arnold atarray.
+    // USD radiance:sphericalHarmonicsCoefficients stores raw coefficients, while
+    // Arnold's gaussianEvalSh expects the DC term to be pre-stored as
+    // (raw_f_dc * C0 + 0.5). It is normalized while building the Arnold array.
     bool gsShSet = false;
     {
         UsdAttribute shAttr;
-        bool isFloat = gs.UsesFloatRadianceCoefficients(&shAttr);
-        if (shAttr) {
-            std::vector<GfVec3f> shCoeffs;
-            if (isFloat) {
-                VtArray<GfVec3f> tmp;
-                if (shAttr.Get(&tmp, frame) && !tmp.empty())
-                    shCoeffs.assign(tmp.begin(), tmp.end());
-            } else {
-                VtArray<GfVec3h> tmph;
-                if (shAttr.Get(&tmph, frame) && !tmph.empty()) {
-                    shCoeffs.resize(tmph.size());
-                    for (size_t i = 0; i < tmph.size(); ++i)
-                        shCoeffs[i] = GfVec3f(tmph[i]);
-                }
-            }
-            if (!shCoeffs.empty()) {
-                // Determine how many SH coefficients exist per point so we
-                // can locate the DC term (index 0 per particle).
-                AtArray* ptsArray = AiNodeGetArray(node, str::points);
-                if (ptsArray) {
-                    const size_t nPts = AiArrayGetNumElements(ptsArray);
-                    if (nPts > 0 && shCoeffs.size() % nPts == 0) {
-                        const size_t nPerPt = shCoeffs.size() / nPts;
-                        if (nPerPt == 1 || nPerPt == 4 || nPerPt == 9 || nPerPt == 16) {
-                            constexpr float C0 = 0.28209479177387814f;
-                            for (size_t i = 0; i < nPts; ++i) {
-                                GfVec3f& dc = shCoeffs[i * nPerPt];
-                                dc = dc * C0 + GfVec3f(0.5f);
-                            }
-                        }
-                    }
-                }
-                AiNodeSetArray(node, str::gs_sh,
-                    AiArrayConvert(shCoeffs.size(), 1, AI_TYPE_RGB, shCoeffs.data()));
-                gsShSet = true;
-            }
-        }
+        gs.UsesFloatRadianceCoefficients(&shAttr);
+        VtValue shCoeffs;
+        if (shAttr && shAttr.Get(&shCoeffs, frame))
+            gsShSet = ArnoldUsdSetGaussianSplatShCoefficients(node, shCoeffs, true);
     }
 
     // --- Spherical harmonics fallback: primvars:displayColor ----------------
@@ -1854,6 +1737,23 @@ AtNode* UsdArnoldReadPointInstancer::Read(const UsdPrim &prim, UsdArnoldReaderCo
     AtNode *node = context.CreateArnoldNode("instancer", prim.GetPath().GetText());
 
     ReadMatrix(prim, node, time, context);    
+
+    std::vector<bool> pruneMaskValues = pointInstancer.ComputeMaskAtTime(frame);
+    if (!pruneMaskValues.empty() && pruneMaskValues.size() != numInstances) {
+        // If the amount of prune mask elements doesn't match the amount of instances,
+        // then something is wrong. We dump an error and clear the mask vector.
+        AiMsgError("[usd] Point instancer %s : Mismatch in length of indices and mask", primName.c_str());
+        pruneMaskValues.clear();
+    }
+    // Prototypes that aren't used by any remaining instance don't need a nested procedural,
+    // which would otherwise be expanded (and read the usd stage) for nothing
+    std::vector<bool> protoUsed(protoPaths.size(), false);
+    for (size_t i = 0; i < numInstances; ++i) {
+        if (protoIndices[i] >= 0 && protoIndices[i] < (int) protoPaths.size() &&
+            (pruneMaskValues.empty() || pruneMaskValues[i]))
+            protoUsed[protoIndices[i]] = true;
+    }
+
     // initialize the nodes array to the proper size    
     std::vector<AtNode *> nodesVec(protoPaths.size(), nullptr);
     std::vector<std::string> nodesRefs(protoPaths.size());
@@ -1924,9 +1824,10 @@ AtNode* UsdArnoldReadPointInstancer::Read(const UsdPrim &prim, UsdArnoldReaderCo
 
         if (createProto) {
             // There's no AtNode for this proto, we need to create a usd procedural that loads
-            // the same usd file but points only at this object path
-
-            nodesVec[i] = reader->CreateNestedProc(protoPath.GetText(), context);
+            // the same usd file but points only at this object path. Its instances are all
+            // hidden if the prototype is invisible or unused, so we can skip it altogether
+            if (protoUsed[i] && protoVisibility[i] != 0)
+                nodesVec[i] = reader->CreateNestedProc(protoPath.GetText(), context);
 
             // we keep track that this prototype relies on a child usd procedural
             nodesChildProcs[i] = true;
@@ -1956,14 +1857,6 @@ AtNode* UsdArnoldReadPointInstancer::Read(const UsdPrim &prim, UsdArnoldReaderCo
     if (times.empty()) {
         times.push_back(frame);
     }
-    std::vector<bool> pruneMaskValues = pointInstancer.ComputeMaskAtTime(frame);
-    if (!pruneMaskValues.empty() && pruneMaskValues.size() != numInstances) {
-        // If the amount of prune mask elements doesn't match the amount of instances,
-        // then something is wrong. We dump an error and clear the mask vector.
-        AiMsgError("[usd] Point instancer %s : Mismatch in length of indices and mask", primName.c_str());
-        pruneMaskValues.clear();
-    }
-    
     // First, get the velocities and accelerations at the current frame.
     // If set, they will be used to compute the motion blur
     VtVec3fArray velocities;
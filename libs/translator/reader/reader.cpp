@@ -40,7 +40,10 @@
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 
 #include <cstdio>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -49,6 +52,7 @@
 #include "prim_reader.h"
 #include "registry.h"
 
+#include "profile_utils.h"
 #include "rendersettings_utils.h"
 #include "parameters_utils.h"
 //-*************************************************************************
@@ -65,6 +69,7 @@ namespace {
 
         // function that gets executed when calling WorkDispatcher::Run
         void operator() () const {
+            ArnoldUsdProfileScope profileScope("prim_types", prim.GetTypeName().GetString());
             // use the primReader to read the input primitive, with the
             // provided context
             reader->Read(prim, *context);
@@ -75,8 +80,21 @@ namespace {
 };
 
 
-static AtMutex s_globalReaderMutex;
-static std::unordered_map<long int, int> s_cacheRefCount;
+// Stages shared with nested procedurals through the UsdStageCache are reference counted,
+// and erased from the cache once the last procedural finished reading them. The map is only
+// modified when a stage is inserted or erased, the counters themselves are atomic so that
+// nested procedurals never need an exclusive lock to acquire or release a stage.
+using CacheRefCount = std::shared_ptr<std::atomic<int>>;
+static std::shared_timed_mutex s_cacheRefCountMutex;
+static std::unordered_map<long int, CacheRefCount> s_cacheRefCount;
+
+static CacheRefCount FindCacheRefCount(long int cacheId)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(s_cacheRefCountMutex);
+    const auto it = s_cacheRefCount.find(cacheId);
+    return it == s_cacheRefCount.end() ? CacheRefCount() : it->second;
+}
+
 UsdArnoldReader::UsdArnoldReader(AtUniverse *universe, AtNode *procParent)
         : ProceduralReader(),
           _procParent(procParent),
@@ -452,8 +470,11 @@ void UsdArnoldReader::ReadStage(UsdStageRefPtr stage, const std::string &path)
     // all nodes under a point instancer hierarchy need to be hidden. So during our 
     // traversal we want to count the amount of point instancers below the current hierarchy,
     // so that we can re-enable visibility when the count is back to 0 (#458)
-    TraverseStage(rootPrimPtr, context, true, true, nullptr);
-    _dispatcher->Wait();
+    {
+        ArnoldUsdProfileScope profileScope("phases", "traverse", true);
+        TraverseStage(rootPrimPtr, context, true, true, nullptr);
+        _dispatcher->Wait();
+    }
 
     _nodes.insert(_nodes.end(), _apiAdapter->GetNodes().begin(), _apiAdapter->GetNodes().end());
     _nodeNames.insert(_apiAdapter->GetNodeNames().begin(), _apiAdapter->GetNodeNames().end());
@@ -471,7 +492,10 @@ void UsdArnoldReader::ReadStage(UsdStageRefPtr stage, const std::string &path)
     // In a second step, each thread goes through the connections it stacked
     // and processes them given that now all the nodes were supposed to be created.
     _readStep = READ_PROCESS_CONNECTIONS;
-    _apiAdapter->ProcessConnections();
+    {
+        ArnoldUsdProfileScope profileScope("phases", "connections", true);
+        _apiAdapter->ProcessConnections();
+    }
     
     
     // There is an exception though, some connections could be pointing
@@ -491,6 +515,7 @@ void UsdArnoldReader::ReadStage(UsdStageRefPtr stage, const std::string &path)
     // synchronizations between the threads.
     _readStep = READ_DANGLING_CONNECTIONS;
     if (!danglingConnections.empty()) {
+        ArnoldUsdProfileScope profileScope("phases", "dangling_connections", true);
         // loop over the dangling connections, ensure the node still doesn't exist
         // (as it might be referenced multiple times in our list),
         // and if not we try to read it
@@ -519,19 +544,23 @@ void UsdArnoldReader::ReadStage(UsdStageRefPtr stage, const std::string &path)
     }
 
     // Finally, process all the light links
-    ReadLightLinks();
+    {
+        ArnoldUsdProfileScope profileScope("phases", "light_links", true);
+        ReadLightLinks();
+    }
 
     if (_cacheId != 0) {
-        std::lock_guard<AtMutex> guard(s_globalReaderMutex);        
-        const auto &cacheIter = s_cacheRefCount.find(_cacheId);
-        if (cacheIter != s_cacheRefCount.end()) {
-            if (--cacheIter->second <= 0) {
-                UsdStageCache &stageCache = UsdUtilsStageCache::Get();                
-                s_cacheRefCount.erase(cacheIter);
-                stageCache.Erase(UsdStageCache::Id::FromLongInt(_cacheId));
-                _cacheId = 0;
-                // now our reader will have a cacheID
+        if (!_cacheRefCount)
+            _cacheRefCount = FindCacheRefCount(_cacheId);
+        if (_cacheRefCount && _cacheRefCount->fetch_sub(1) <= 1) {
+            std::unique_lock<std::shared_timed_mutex> lock(s_cacheRefCountMutex);
+            // InitCacheId might have inserted the same stage again in the meantime
+            if (_cacheRefCount->load() <= 0) {
+                s_cacheRefCount.erase(_cacheId);
+                UsdUtilsStageCache::Get().Erase(UsdStageCache::Id::FromLongInt(_cacheId));
             }
+            _cacheRefCount.reset();
+            _cacheId = 0;
         }
     }
     _readStep = READ_FINISHED; // We're done
@@ -669,6 +698,7 @@ void UsdArnoldReader::ReadPrimitive(const UsdPrim &prim, UsdArnoldReaderContext
                     context.SetMatrices(newMatrices);
                 }
             }
+            ArnoldUsdProfileScope profileScope("prim_types", objType);
             primReader->Read(prim, context); // read this primitive
             if (parentMatrix && newMatrices) {
                 context.SetMatrices(prevMatrices);
@@ -947,13 +977,17 @@ void UsdArnoldReader::InitCacheId()
 
     // Get a UsdStageCache, insert our current usd stage,
     // and get its ID
-    std::lock_guard<AtMutex> guard(s_globalReaderMutex);
+    std::unique_lock<std::shared_timed_mutex> lock(s_cacheRefCountMutex);
     UsdStageCache &stageCache = UsdUtilsStageCache::Get();
     UsdStageCache::Id id = stageCache.Insert(_stage);
     // now our reader will have a cacheID
     _cacheId = id.ToLongInt();
     // stageCache.Insert can return an existing stage, so we increase the ref count for that stage in case it exists
-    s_cacheRefCount[_cacheId]++; 
+    CacheRefCount &refCount = s_cacheRefCount[_cacheId];
+    if (!refCount)
+        refCount = std::make_shared<std::atomic<int>>(0);
+    refCount->fetch_add(1);
+    _cacheRefCount = refCount;
 }
 // Return a AtNode representing a whole part of the scene hierarchy, as needed e.g. for instancing.
 // In this case, we create a nested procedural and give it an "object_path" so that it only represents 
@@ -970,18 +1004,22 @@ AtNode *UsdArnoldReader::CreateNestedProc(const char *objectPath, UsdArnoldReade
     AtNode *proto = context.CreateArnoldNode(childUsdEntry.c_str(), objectPath);
     AiNodeSetStr(proto, str::filename, AtString(_filename.c_str()));
 
-    if (_cacheId == 0) {
-        // this reader doesn't have any cache Id. However, we want to create one for its nested procs
-        InitCacheId(); 
-    }
     {
-        // Now increment the ref count for this cache ID
-        std::lock_guard<AtMutex> guard(s_globalReaderMutex);
-        const auto &cacheIdIter = s_cacheRefCount.find(_cacheId);
-        if (cacheIdIter != s_cacheRefCount.end())
-            cacheIdIter->second++;        
+        // Prototypes can be created from several traversal threads, but this
+        // lock is local to this reader
+        std::lock_guard<AtMutex> guard(_cacheIdLock);
+        if (_cacheId == 0) {
+            // this reader doesn't have any cache Id. However, we want to create one for its nested procs
+            InitCacheId();
+        } else if (!_cacheRefCount) {
+            _cacheRefCount = FindCacheRefCount(_cacheId);
+        }
     }
-    
+    // Now increment the ref count for this cache ID, it will be released once
+    // the nested procedural has read the stage
+    if (_cacheRefCount)
+        _cacheRefCount->fetch_add(1);
+
 
     // The current USD stageCache implementation use an ID counter which starts at 9223000 and increase it everytime a stage is added.
     // So it should most likely stay in the integer range. But if the implementation changes, we need to make sure we catch it.
@@ -28,6 +28,8 @@
 #include <pxr/usd/usdSkel/root.h>
 #include <pxr/usd/usdSkel/cache.h>
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <iostream>
 #include <unordered_map>
@@ -250,6 +252,9 @@ private:
     StageListener _listener;
     TfNotice::Key _objectsChangedNoticeKey;
     bool _updating = false; // boolean enabled during the Update() function
+    // Reference count of the stage shared with the nested procedurals, see CreateNestedProc
+    std::shared_ptr<std::atomic<int>> _cacheRefCount;
+    AtMutex _cacheIdLock;
 };
 
 class UsdArnoldAPI : public ArnoldAPIAdapter {
@@ -193,7 +193,10 @@ void UsdArnoldWriter::Write(const AtUniverse *universe)
     const int shadersMask = UsdArnoldPrimWriter::GetShadersMask();
     AtNodeIterator *iter = AiUniverseGetNodeIterator(_universe, _mask  & ~shadersMask);
     while (!AiNodeIteratorFinished(iter)) {
-        WritePrimitive(AiNodeIteratorGetNext(iter));
+        AtNode *node = AiNodeIteratorGetNext(iter);
+        if (_nodeFilter && _nodeFilter->find(node) == _nodeFilter->end())
+            continue;
+        WritePrimitive(node);
     }
     AiNodeIteratorDestroy(iter);
 
@@ -216,6 +219,8 @@ void UsdArnoldWriter::Write(const AtUniverse *universe)
             // part of a shading tree assigned to a geometry
             if (_exportedShaders.find(node) != _exportedShaders.end())
                 continue;
+            if (_nodeFilter && _nodeFilter->find(node) == _nodeFilter->end())
+                continue;
 
             WritePrimitive(node);
 
@@ -23,6 +23,7 @@
 #include <pxr/usd/usdGeom/primvar.h>
 
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -236,6 +237,10 @@ public:
     void SetMetersPerUnit(float metersPerUnit) { _metersPerUnit = metersPerUnit; }
     float GetMetersPerUnit() const { return _metersPerUnit; }
 
+    // Restrict Write() to a given set of nodes, e.g. the contents of a single procedural.
+    // The set isn't owned by the writer and must outlive the call to Write()
+    void SetNodeFilter(const std::unordered_set<const AtNode *> *nodes) { _nodeFilter = nodes; }
+
 private:
     const AtUniverse *_universe;        // Arnold universe to be converted
     UsdArnoldWriterRegistry *_registry; // custom registry used for this writer. If null, a global
@@ -262,4 +267,5 @@ private:
     bool _appendFile = false;
     std::string _upAxis;
     float _metersPerUnit;
+    const std::unordered_set<const AtNode *> *_nodeFilter = nullptr;
 };
@@ -10,6 +10,9 @@
 #if ARNOLD_VERSION_NUM >= 70405
 
 #include <pxr/pxr.h>
+#include <pxr/base/arch/env.h>
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stringUtils.h>
@@ -28,8 +31,14 @@
 #include <pxr/usd/usdRender/settings.h>
 #include <pxr/usd/usdShade/udimUtils.h>
 #include <pxr/usd/usdUtils/dependencies.h>
+#include <pxr/base/work/loops.h>
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iomanip>
+#include <mutex>
+#include <random>
 #include <sstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -60,6 +69,8 @@ struct SdfPrimSpecHandleEqual
 
 typedef std::unordered_map<const SdfPrimSpecHandle, std::vector<UsdPrim>, SdfPrimSpecHandleHash, SdfPrimSpecHandleEqual> UsdPrimMap;
 
+inline void CreateUsdPrimMap(const UsdStageRefPtr& stage, UsdPrimMap& usdPrimMap);
+
 /**
  * A wrapper over the AiBegin/AiEnd calls to follow the RAII technique,
  * and close the session when the object goes out of scope.
@@ -173,17 +184,44 @@ inline std::string ComputeRelativePathToRoot(UsdStageRefPtr stage, const std::st
     return relative;
 }
 
+/**
+ * Map of the Usd prims including each Sdf prim spec, shared by all the layers.
+ * It requires a traversal of the composed stage, so it is only built
+ * if a scanned layer has variant sets.
+ */
+class LazyUsdPrimMap
+{
+public:
+    explicit LazyUsdPrimMap(const UsdStageRefPtr& stage) : m_stage(stage) {}
+
+    const UsdPrimMap& Get()
+    {
+        std::call_once(m_once, [this]() { CreateUsdPrimMap(m_stage, m_usdPrimMap); });
+        return m_usdPrimMap;
+    }
+
+private:
+    UsdStageRefPtr m_stage;
+    std::once_flag m_once;
+    UsdPrimMap m_usdPrimMap;
+};
+
 /**
  * Helper struct that passed to dependency collector functions.
+ * There is one per layer, so that layers can be scanned in parallel.
  */
 struct DependencyData
 {
     UsdStageRefPtr stage;
     SdfLayerHandle layer;
     std::vector<USDDependency> dependencies;
+    // The references as authored in the layer, one per dependency
+    std::vector<std::string> authoredReferences;
     SeenReferenceMap seenReferences;
     ArResolver& resolver = ArGetResolver();
-    UsdPrimMap usdPrimMap;
+    LazyUsdPrimMap* usdPrimMap = nullptr;
+    // The dependencies depend on variant selections authored in other layers
+    bool usesComposedVariantSelections = false;
 };
 
 void TraversePrimSpecs(const SdfPrimSpecHandle& prim, DependencyData& data);
@@ -292,6 +330,7 @@ inline void AddDependency(const std::string& ref, USDDependency::Type type,
     // create a dependency
     data.dependencies.push_back(USDDependency(type, anchoredPath,
         resolvedPath, data.layer, primPath, primTypeName, attribute));
+    data.authoredReferences.push_back(ref);
 }
 
 /**
@@ -342,6 +381,10 @@ inline void CollectOslShaderDependencies(const SdfPrimSpecHandle& prim, Dependen
     if (code.empty())
         return;
 
+    // Layers are scanned in parallel, but we only create one temporary universe at a time
+    static std::mutex oslMutex;
+    std::lock_guard<std::mutex> guard(oslMutex);
+
     // load the OSL shader in an Arnold universe
     AtUniverse* universe = AiUniverse();
     if (universe == nullptr)
@@ -387,7 +430,7 @@ inline void CollectOslShaderDependencies(const SdfPrimSpecHandle& prim, Dependen
 /**
  * Returns all Usd prims that include the given Sdf prim spec.
  */
-inline std::vector<UsdPrim> FindUsdPrims(const SdfPrimSpecHandle& primSpec, UsdPrimMap& usdPrimMap)
+inline std::vector<UsdPrim> FindUsdPrims(const SdfPrimSpecHandle& primSpec, const UsdPrimMap& usdPrimMap)
 {
     auto it = usdPrimMap.find(primSpec);
     return it != usdPrimMap.end() ? it->second : std::vector<UsdPrim>();
@@ -428,7 +471,8 @@ inline VariantSelectionMap GetVariantSelection(const SdfPrimSpecHandle& prim, De
     // The sdf prim contains selections defined within the layer that authors the prim,
     // while the usd prim contains composed selections across all layers
     // A prim spec can contribute to multiple usd prims
-    std::vector<UsdPrim> usdPrims = FindUsdPrims(prim, data.usdPrimMap);
+    std::vector<UsdPrim> usdPrims = FindUsdPrims(prim, data.usdPrimMap->Get());
+    data.usesComposedVariantSelections = true;
 
     const auto vsets = prim->GetVariantSets();
     for (const auto& vsetIt : vsets.items())
@@ -814,27 +858,166 @@ inline void CollectDependenciesFromLayer(const SdfLayerHandle& layer, Dependency
     TraverseLayer(layer, data);
 }
 
+// Bump this whenever the dependency scan changes in a way that invalidates previous results
+constexpr int AssetCacheVersion = 2;
+
+/**
+ * Returns the file caching the dependencies of a layer, or an empty string
+ * if the cache is disabled or the layer can't be cached.
+ *
+ * The cache is enabled by setting the environment variable PROCEDURAL_ASSET_CACHE
+ * to a directory. The file name is a hash of the layer identifier, its modification
+ * time and size, and the root layer of the stage, since relative paths are
+ * converted relative to the main scene.
+ *
+ * Only the authored references are cached, since resolving them depends on the
+ * resolver context and on which files exist. They are resolved again on read.
+ */
+inline std::string GetLayerCachePath(const SdfLayerHandle& layer, const UsdStageRefPtr& stage)
+{
+    static const std::string cacheDir = []() {
+        std::string dir = ArchGetEnv("PROCEDURAL_ASSET_CACHE");
+        if (!dir.empty() && !TfIsDir(dir) && !TfMakeDirs(dir, -1, true))
+        {
+            AiMsgWarning("[usd] Cannot create the asset cache directory %s", dir.c_str());
+            dir.clear();
+        }
+        return dir;
+    }();
+    if (cacheDir.empty() || !layer || layer->IsAnonymous() || layer->IsDirty())
+        return std::string();
+
+    const std::string realPath = layer->GetRealPath();
+    double modificationTime = 0.0;
+    if (realPath.empty() || !ArchGetModificationTime(realPath.c_str(), &modificationTime))
+        return std::string();
+
+    const std::string key = TfStringPrintf("v%d|%s|%s|%.6f|%lld", AssetCacheVersion, layer->GetIdentifier().c_str(),
+        stage->GetRootLayer()->GetIdentifier().c_str(), modificationTime,
+        static_cast<long long>(ArchGetFileLength(realPath.c_str())));
+    const uint64_t hash = ArchHash64(key.data(), key.size());
+    return TfStringCatPaths(cacheDir, TfStringPrintf("%016llx.assets", static_cast<unsigned long long>(hash)));
+}
+
+/**
+ * Reads the references of a layer from its cache file, and resolves them
+ * as if they were found by scanning the layer.
+ * Each line stores a reference as tab separated fields.
+ */
+inline bool ReadLayerCache(const std::string& cachePath, const SdfLayerHandle& layer, DependencyData& data)
+{
+    std::ifstream is(cachePath);
+    if (!is.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(is, line) || line != TfStringPrintf("arnold_usd_assets %d", AssetCacheVersion))
+        return false;
+
+    std::vector<std::vector<std::string>> entries;
+    while (std::getline(is, line))
+    {
+        std::vector<std::string> fields = TfStringSplit(line, "\t");
+        if (fields.size() != 5)
+            return false;
+        entries.push_back(std::move(fields));
+    }
+
+    data.layer = layer;
+    for (const std::vector<std::string>& fields : entries)
+    {
+        AddDependency(fields[1], static_cast<USDDependency::Type>(std::atoi(fields[0].c_str())),
+            fields[2].empty() ? SdfPath() : SdfPath(fields[2]), TfToken(fields[3]),
+            fields[4].empty() ? SdfPath() : SdfPath(fields[4]), data);
+    }
+    return true;
+}
+
+/**
+ * Writes the references of a layer to its cache file.
+ */
+inline void WriteLayerCache(const std::string& cachePath, const DependencyData& data)
+{
+    std::ostringstream os;
+    os << "arnold_usd_assets " << AssetCacheVersion << "\n";
+    for (size_t i = 0; i < data.dependencies.size(); ++i)
+    {
+        const USDDependency& dep = data.dependencies[i];
+        const std::string& ref = data.authoredReferences[i];
+        if (ref.find_first_of("\t\n") != std::string::npos)
+            return;
+        os << static_cast<int>(dep.type) << "\t" << ref << "\t" << dep.primPath.GetString() << "\t"
+           << dep.primTypeName.GetString() << "\t" << dep.attribute.GetString() << "\n";
+    }
+
+    // Write to a temporary file first, so that concurrent jobs never read a partial cache
+    const std::string tmpPath = TfStringPrintf("%s.%08x.tmp", cachePath.c_str(),
+        static_cast<unsigned int>(std::random_device{}()));
+    {
+        std::ofstream file(tmpPath);
+        if (!file.is_open())
+            return;
+        file << os.str();
+    }
+    if (std::rename(tmpPath.c_str(), cachePath.c_str()) != 0)
+        std::remove(tmpPath.c_str());
+}
+
 /**
  * Returns all dependencies found in a USD scene.
  *
  * The function iterates over all prims in all used layers
  * and collects dependencies defined in asset type attributes.
  * Also collects sublayers, references and payloads.
+ *
+ * Layers are scanned in parallel, and the references of unmodified layers
+ * are read from the asset cache if it is enabled. Layers with variant sets
+ * are always scanned, since their dependencies depend on selections that can
+ * be authored anywhere in the stage.
  */
 std::vector<USDDependency> CollectDependencies(UsdStageRefPtr stage)
 {
-    DependencyData data;
-    data.stage = stage;
-
-    // create a map that lists all UsdPrims that include an SdfPrim
-    CreateUsdPrimMap(stage, data.usdPrimMap);
+    // create a map that lists all UsdPrims that include an SdfPrim,
+    // only if it's needed to read variant selections
+    LazyUsdPrimMap usdPrimMap(stage);
 
     // collect dependencies from all used layers
-    SdfLayerHandleVector usedLayers = stage->GetUsedLayers();
-    for (auto &layer : usedLayers)
-        CollectDependenciesFromLayer(layer, data);
+    const SdfLayerHandleVector usedLayers = stage->GetUsedLayers();
+    std::vector<std::vector<USDDependency>> layerDependencies(usedLayers.size());
+    WorkParallelForN(usedLayers.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const SdfLayerHandle& layer = usedLayers[i];
+            const std::string cachePath = GetLayerCachePath(layer, stage);
+            if (!cachePath.empty())
+            {
+                DependencyData cached;
+                cached.stage = stage;
+                if (ReadLayerCache(cachePath, layer, cached))
+                {
+                    layerDependencies[i] = std::move(cached.dependencies);
+                    continue;
+                }
+            }
+
+            DependencyData data;
+            data.stage = stage;
+            data.usdPrimMap = &usdPrimMap;
+            CollectDependenciesFromLayer(layer, data);
+            if (!cachePath.empty() && !data.usesComposedVariantSelections)
+                WriteLayerCache(cachePath, data);
+            layerDependencies[i] = std::move(data.dependencies);
+        }
+    });
 
-    return data.dependencies;
+    // keep the order of the used layers
+    std::vector<USDDependency> dependencies;
+    for (auto& deps : layerDependencies)
+    {
+        dependencies.insert(dependencies.end(), std::make_move_iterator(deps.begin()),
+            std::make_move_iterator(deps.end()));
+    }
+    return dependencies;
 }
 
 /**
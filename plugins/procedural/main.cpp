@@ -37,6 +37,7 @@
 #include <pxr/usd/usdUtils/stageCache.h>
 #include "writer.h"
 #include "asset_utils.h"
+#include "snapshot_cache.h"
 
 #if defined(_DARWIN) || defined(_LINUX)
 #include <dlfcn.h>
@@ -184,19 +185,22 @@ procedural_init
     }
 
     std::string objectPath(AiNodeGetStr(node, AtString("object_path")));
-    data->SetFrame(AiNodeGetFlt(node, AtString("frame")));
-    data->SetId(AiNodeGetUInt(node, AtString("id")));
-    data->SetInteractive(interactive);
-
-    AtNode *renderCam = AiUniverseGetCamera(AiNodeGetUniverse(node));
-    if (renderCam &&
-        (AiNodeGetFlt(renderCam, AtString("shutter_start")) < AiNodeGetFlt(renderCam, AtString("shutter_end")))) {
-        float motionStart = AiNodeGetFlt(renderCam, AtString("shutter_start"));
-        float motionEnd = AiNodeGetFlt(renderCam, AtString("shutter_end"));
-        data->SetMotionBlur((motionStart < motionEnd), motionStart, motionEnd);
-    } else {
-        data->SetMotionBlur(false);
-    }
+    auto configureReader = [&](ProceduralReader *reader) {
+        reader->SetFrame(AiNodeGetFlt(node, AtString("frame")));
+        reader->SetId(AiNodeGetUInt(node, AtString("id")));
+        reader->SetInteractive(interactive);
+
+        AtNode *renderCam = AiUniverseGetCamera(AiNodeGetUniverse(node));
+        if (renderCam &&
+            (AiNodeGetFlt(renderCam, AtString("shutter_start")) < AiNodeGetFlt(renderCam, AtString("shutter_end")))) {
+            float motionStart = AiNodeGetFlt(renderCam, AtString("shutter_start"));
+            float motionEnd = AiNodeGetFlt(renderCam, AtString("shutter_end"));
+            reader->SetMotionBlur((motionStart < motionEnd), motionStart, motionEnd);
+        } else {
+            reader->SetMotionBlur(false);
+        }
+    };
+    configureReader(data);
 
     int cache_id = AiNodeGetInt(node, AtString("cache_id"));
     if (cache_id != 0) {
@@ -215,8 +219,30 @@ procedural_init
     std::string filename(AiResolveFilePath(originalFilename.c_str(), AtFileType::Procedural));
 #endif
     applyProceduralSearchPath(filename, nullptr);
-    data->Read(filename, AiNodeGetArray(node, AtString("overrides")), objectPath);
-    
+    AtArray *overrides = AiNodeGetArray(node, AtString("overrides"));
+
+    // Interactive procedurals need a live reader to apply the stage updates,
+    // so they're always translated
+    if (interactive) {
+        data->Read(filename, overrides, objectPath);
+        return 1;
+    }
+
+    ProceduralSnapshotCache snapshotCache(node, filename, overrides, objectPath);
+    if (snapshotCache.IsEnabled()) {
+        // The snapshot only contains Arnold schemas, that are read directly by the usd reader
+        ProceduralReader *snapshotReader = new UsdArnoldReader(AiNodeGetUniverse(node), node);
+        configureReader(snapshotReader);
+        if (snapshotCache.Load(snapshotReader)) {
+            delete data;
+            *user_ptr = snapshotReader;
+            return 1;
+        }
+        delete snapshotReader;
+    }
+    data->Read(filename, overrides, objectPath);
+    snapshotCache.Store(data);
+
     return 1;
 }
 
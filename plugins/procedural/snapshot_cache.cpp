@@ -0,0 +1,178 @@
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snapshot_cache.h"
+
+#include <pxr/base/arch/env.h>
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/arch/hash.h>
+#include <pxr/base/tf/fileUtils.h>
+#include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/layerUtils.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <constant_strings.h>
+#include <procedural_reader.h>
+#include "writer.h"
+
+#include <cstdio>
+#include <random>
+#include <unordered_set>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Bump this whenever the translation changes in a way that invalidates previous snapshots
+constexpr int SnapshotVersion = 1;
+
+} // namespace
+
+ProceduralSnapshotCache::ProceduralSnapshotCache(const AtNode *procedural, const std::string &filename,
+        const AtArray *overrides, const std::string &objectPath)
+    : _procedural(procedural)
+{
+    const std::string cacheDir = ArchGetEnv("PROCEDURAL_SNAPSHOT_CACHE");
+    if (cacheDir.empty() || procedural == nullptr)
+        return;
+    if (!TfIsDir(cacheDir) && !TfMakeDirs(cacheDir, -1, true)) {
+        AiMsgWarning("[usd] Cannot create the snapshot cache directory %s", cacheDir.c_str());
+        return;
+    }
+
+    _frame = AiNodeGetFlt(procedural, str::frame);
+
+    // The hydra procedural translates differently with scene index emulation, so its switch is part of the key
+    std::string key = TfStringPrintf("v%d|%s|%s|%s|%g|%u|%d|%s|%s", SnapshotVersion, AI_VERSION, filename.c_str(),
+        objectPath.c_str(), _frame, AiNodeGetUInt(procedural, str::id), AiNodeGetBool(procedural, str::hydra),
+        ArchGetEnv("PROCEDURAL_USE_HYDRA").c_str(), ArchGetEnv("USDIMAGINGGL_ENGINE_ENABLE_SCENE_INDEX").c_str());
+    // The render delegate settings changing the translated nodes of the hydra procedural
+    for (const char *setting : {"HDARNOLD_share_volumes", "HDARNOLD_dedup_materials"}) {
+        key += "|";
+        key += ArchGetEnv(setting);
+    }
+
+    AtUniverse *universe = AiNodeGetUniverse(procedural);
+    AtNode *options = AiUniverseGetOptions(universe);
+    if (options && AiNodeEntryLookUpParameter(AiNodeGetNodeEntry(options), str::usd_legacy_translation))
+        key += AiNodeGetBool(options, str::usd_legacy_translation) ? "|legacy" : "|";
+
+    // Motion blur is read from the render camera in procedural_init, and changes the amount of keys
+    // translated for every shape
+    AtNode *renderCam = AiUniverseGetCamera(universe);
+    if (renderCam) {
+        key += TfStringPrintf("|%g|%g", AiNodeGetFlt(renderCam, str::shutter_start),
+            AiNodeGetFlt(renderCam, str::shutter_end));
+    }
+
+    if (!filename.empty()) {
+        SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(filename);
+        _FingerprintLayer(rootLayer, filename, key);
+    }
+
+    const unsigned int overrideCount = overrides ? AiArrayGetNumElements(overrides) : 0;
+    for (unsigned int i = 0; i < overrideCount; ++i) {
+        const std::string overrideStr(AiArrayGetStr(overrides, i).c_str());
+        key += "|";
+        key += overrideStr;
+        // The overrides can themselves reference or sublayer other files
+        SdfLayerRefPtr overrideLayer = SdfLayer::CreateAnonymous(".usda");
+        if (overrideLayer->ImportFromString(overrideStr))
+            _FingerprintLayer(overrideLayer, std::string(), key);
+    }
+
+    const uint64_t hash = ArchHash64(key.data(), key.size());
+    _snapshotPath = TfStringCatPaths(cacheDir, TfStringPrintf("%016llx.usdc", static_cast<unsigned long long>(hash)));
+}
+
+void ProceduralSnapshotCache::_FingerprintLayer(
+    const SdfLayerRefPtr &layer, const std::string &layerPath, std::string &key)
+{
+    if (!layer) {
+        // Missing layers are part of the key as well, in case they appear later on
+        key += "|missing:";
+        key += layerPath;
+        return;
+    }
+    if (!_visitedLayers.insert(layer->GetIdentifier()).second)
+        return;
+    _layers.push_back(layer);
+
+    key += "|";
+    key += layer->GetIdentifier();
+    if (!layer->IsAnonymous()) {
+        const std::string realPath = layer->GetRealPath();
+        double modificationTime = 0.0;
+        ArchGetModificationTime(realPath.c_str(), &modificationTime);
+        key += TfStringPrintf("|%.6f|%lld", modificationTime, static_cast<long long>(ArchGetFileLength(realPath.c_str())));
+    }
+
+    // Includes the sublayers, references and payloads of every variant, since the
+    // variant selections might be authored in a different layer
+    for (const std::string &dependency : layer->GetCompositionAssetDependencies()) {
+        if (dependency.empty())
+            continue;
+        const std::string dependencyPath = SdfComputeAssetPathRelativeToLayer(layer, dependency);
+        _FingerprintLayer(SdfLayer::FindOrOpen(dependencyPath), dependencyPath, key);
+    }
+}
+
+bool ProceduralSnapshotCache::Load(ProceduralReader *reader) const
+{
+    if (!IsEnabled() || reader == nullptr || !TfIsFile(_snapshotPath))
+        return false;
+
+    reader->Read(_snapshotPath, nullptr);
+    if (reader->GetNodes().empty())
+        return false;
+
+    AiMsgInfo("[usd] %s : loaded snapshot %s", AiNodeGetName(_procedural), _snapshotPath.c_str());
+    return true;
+}
+
+void ProceduralSnapshotCache::Store(const ProceduralReader *reader) const
+{
+    if (!IsEnabled() || reader == nullptr)
+        return;
+
+    const std::vector<AtNode *> &nodes = reader->GetNodes();
+    if (nodes.empty())
+        return;
+
+    std::unordered_set<const AtNode *> nodeFilter;
+    nodeFilter.reserve(nodes.size());
+    for (const AtNode *node : nodes) {
+        // Nested procedurals sharing our stage through the UsdStageCache can't be reloaded
+        // from a different process
+        const AtNodeEntry *nentry = AiNodeGetNodeEntry(node);
+        if (AiNodeEntryLookUpParameter(nentry, str::cache_id) && AiNodeGetInt(node, str::cache_id) != 0)
+            return;
+        nodeFilter.insert(node);
+    }
+
+    // Write to a temporary file first, so that concurrent renders never read a partial snapshot
+    const std::string tmpPath = TfStringPrintf("%s.%08x.usdc",
+        TfStringGetBeforeSuffix(_snapshotPath).c_str(), static_cast<unsigned int>(std::random_device{}()));
+    UsdStageRefPtr stage = UsdStage::CreateNew(tmpPath);
+    if (!stage) {
+        AiMsgWarning("[usd] Unable to create the snapshot %s", tmpPath.c_str());
+        return;
+    }
+
+    UsdArnoldWriter writer;
+    writer.SetUsdStage(stage);
+    // Arnold schemas, with plain shader connections, so that reading the snapshot
+    // back is a direct copy of the node parameters
+    writer.SetWriteBuiltin(false);
+    writer.SetWriteMaterialBindings(false);
+    writer.SetFrame(_frame);
+    writer.SetNodeFilter(&nodeFilter);
+    writer.Write(AiNodeGetUniverse(_procedural));
+
+    if (!stage->GetRootLayer()->Save() || std::rename(tmpPath.c_str(), _snapshotPath.c_str()) != 0) {
+        AiMsgWarning("[usd] Unable to save the snapshot %s", _snapshotPath.c_str());
+        std::remove(tmpPath.c_str());
+    }
+}
@@ -0,0 +1,53 @@
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/layer.h>
+#include <ai.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+class ProceduralReader;
+
+/**
+ * Local cache of translated procedural contents.
+ *
+ * When the environment variable PROCEDURAL_SNAPSHOT_CACHE points to a directory, the Arnold
+ * nodes created by a usd procedural are saved there as an Arnold-typed usd file (through the
+ * UsdArnoldWriter). The file name is a hash of everything that can affect the translation :
+ * the layer stack (identifiers, file sizes and modification times of every layer reachable
+ * through sublayers, references and payloads), the serialized overrides, object_path, frame,
+ * motion blur settings, and the procedural id. Next time the same procedural is expanded with
+ * an identical key, the snapshot is read instead of the original stage, which skips the
+ * translation of usd primitives.
+ */
+class ProceduralSnapshotCache {
+public:
+    ProceduralSnapshotCache(const AtNode *procedural, const std::string &filename,
+        const AtArray *overrides, const std::string &objectPath);
+
+    bool IsEnabled() const { return !_snapshotPath.empty(); }
+    const std::string &GetSnapshotPath() const { return _snapshotPath; }
+
+    /// Returns true if a snapshot was found for this procedural, and was loaded by the reader
+    bool Load(ProceduralReader *reader) const;
+    /// Save the nodes created by the reader to the snapshot file
+    void Store(const ProceduralReader *reader) const;
+
+private:
+    void _FingerprintLayer(const SdfLayerRefPtr &layer, const std::string &layerPath, std::string &key);
+
+    const AtNode *_procedural;
+    float _frame = 0.f;
+    std::string _snapshotPath;
+    // Layers opened while computing the key. We hold them until the procedural is read,
+    // so that the reader doesn't need to parse them a second time
+    std::vector<SdfLayerRefPtr> _layers;
+    std::unordered_set<std::string> _visitedLayers;
+};
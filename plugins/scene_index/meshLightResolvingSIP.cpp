@@ -2,6 +2,7 @@
 #ifdef ENABLE_SCENE_INDEX
 #include <pxr/pxr.h>
 
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/imaging/hd/filteringSceneIndex.h>
 
 // Schemas
@@ -107,6 +108,48 @@ HdContainerDataSourceHandle _BuildLightDataSource(
     return HdOverlayContainerDataSource::New(2, handles);
 }
 
+// Returns the locators of the meshLight prim affected by the dirty locators of its mesh
+HdDataSourceLocatorSet _GetMeshLightDirtyLocators(const HdDataSourceLocatorSet &meshLocators)
+{
+    // HdDataSourceLocator::EmptyLocator() == AllDirty in Hydra 1.0
+    static const HdDataSourceLocatorSet allLightLocators{
+        HdLightSchema::GetDefaultLocator(), HdMaterialSchema::GetDefaultLocator(),
+        HdPrimvarsSchema::GetDefaultLocator(), HdVisibilitySchema::GetDefaultLocator(),
+        HdXformSchema::GetDefaultLocator()};
+    if (meshLocators.Contains(HdDataSourceLocator::EmptyLocator())) {
+        return allLightLocators;
+    }
+
+    HdDataSourceLocatorSet lightLocators;
+    if (meshLocators.Intersects(HdLightSchema::GetDefaultLocator()) ||
+        meshLocators.Intersects(HdCategoriesSchema::GetDefaultLocator())) {
+        lightLocators.insert(HdLightSchema::GetDefaultLocator());
+    }
+    if (meshLocators.Intersects(HdMaterialSchema::GetDefaultLocator()) ||
+        meshLocators.Intersects(HdMaterialBindingsSchema::GetDefaultLocator())) {
+        lightLocators.insert(HdMaterialSchema::GetDefaultLocator());
+    }
+    if (meshLocators.Intersects(HdVisibilitySchema::GetDefaultLocator())) {
+        lightLocators.insert(HdVisibilitySchema::GetDefaultLocator());
+    }
+    if (meshLocators.Intersects(HdXformSchema::GetDefaultLocator())) {
+        lightLocators.insert(HdXformSchema::GetDefaultLocator());
+    }
+    // Only the arnold: primvars of the mesh are read by the light, skip the points, normals
+    // and other geometry primvars which are modified by deforming meshes.
+    static const HdDataSourceLocator &primvarsLocator = HdPrimvarsSchema::GetDefaultLocator();
+    for (const HdDataSourceLocator &locator : meshLocators) {
+        if (!locator.HasPrefix(primvarsLocator)) {
+            continue;
+        }
+        if (locator.GetElementCount() < 2 || TfStringStartsWith(locator.GetElement(1).GetString(), "arnold:")) {
+            lightLocators.insert(primvarsLocator);
+            break;
+        }
+    }
+    return lightLocators;
+}
+
 } // namespace
 HdArnoldMeshLightResolvingSceneIndex::HdArnoldMeshLightResolvingSceneIndex(
     const HdSceneIndexBaseRefPtr &inputSceneIndex)
@@ -208,22 +251,22 @@ void HdArnoldMeshLightResolvingSceneIndex::_PrimsRemoved(
 void HdArnoldMeshLightResolvingSceneIndex::_PrimsDirtied(
     const HdSceneIndexBase &sender, const HdSceneIndexObserver::DirtiedPrimEntries &entries)
 {
+    HdSceneIndexObserver::DirtiedPrimEntries dirtied;
     // Parameter change on the meshLight
     for (const auto &entry : entries) {
         if (_meshLights.count(entry.primPath)) {
-            // Propagate dirtiness to the meshLight light if applicable.
-            // HdDataSourceLocator::EmptyLocator() == AllDirty in Hydra 1.0
-            if (entry.dirtyLocators.Intersects(HdDataSourceLocator::EmptyLocator()) ||
-                entry.dirtyLocators.Intersects(HdCategoriesSchema::GetDefaultLocator()) ||
-                entry.dirtyLocators.Intersects(HdMaterialBindingsSchema::GetDefaultLocator())) {
-                _SendPrimsDirtied(
-                    {{entry.primPath.AppendChild(_tokens->lightName),
-                      {HdLightSchema::GetDefaultLocator(), HdMaterialSchema::GetDefaultLocator(),
-                       HdPrimvarsSchema::GetDefaultLocator(), HdVisibilitySchema::GetDefaultLocator(),
-                       HdXformSchema::GetDefaultLocator()}}});
+            // Propagate dirtiness to the meshLight light if applicable. Changes to the mesh
+            // geometry are seen by Arnold through the mesh node, they don't require the light
+            // to be synced again.
+            const HdDataSourceLocatorSet lightLocators = _GetMeshLightDirtyLocators(entry.dirtyLocators);
+            if (!lightLocators.IsEmpty()) {
+                dirtied.emplace_back(entry.primPath.AppendChild(_tokens->lightName), lightLocators);
             }
         }
     }
+    if (!dirtied.empty()) {
+        _SendPrimsDirtied(dirtied);
+    }
     _SendPrimsDirtied(entries);
 }
 
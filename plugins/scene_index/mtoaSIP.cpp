@@ -22,7 +22,11 @@
 
 #include <common_utils.h>
 
+#include <tbb/concurrent_unordered_map.h>
+
+#include <algorithm>
 #include <cctype>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -77,6 +81,20 @@ TfToken _RemapMtoaAiName(const TfToken& name)
     return TfToken(std::string("arnold:") + ArnoldUsdMakeSnakeCase(stripped));
 }
 
+// Returns the remapped name of an MtoA attribute, or an empty token if it's not one.
+// Maya exports the same attributes on every shape, so the remapped names are interned
+// in a table shared by all the prims and each name is only converted once.
+const TfToken& _GetMtoaRemappedName(const TfToken& name)
+{
+    using RemapTable = tbb::concurrent_unordered_map<TfToken, TfToken, TfToken::HashFunctor>;
+    static RemapTable s_remapTable;
+    const auto it = s_remapTable.find(name);
+    if (it != s_remapTable.end()) {
+        return it->second;
+    }
+    return s_remapTable.emplace(name, _IsMtoaAiName(name) ? _RemapMtoaAiName(name) : TfToken()).first->second;
+}
+
 // Wraps an opaque VtValue as an HdSampledDataSource so it can be stored as a
 // primvar value without double-wrapping (unlike HdRetainedTypedSampledDataSource<VtValue>).
 class _VtValueDataSource : public HdSampledDataSource {
@@ -111,10 +129,10 @@ HdDataSourceBaseHandle _BuildAiPrimvarsFromAttrs(
     for (const auto& [key, value] : mayaAttrs) {
         if (skip.count(key))
             continue;
-        const TfToken keyTok(key);
-        if (!_IsMtoaAiName(keyTok))
+        const TfToken& remapped = _GetMtoaRemappedName(TfToken(key));
+        if (remapped.IsEmpty())
             continue;
-        names.push_back(_RemapMtoaAiName(keyTok));
+        names.push_back(remapped);
         sources.push_back(
             HdPrimvarSchema::Builder()
                 .SetPrimvarValue(_VtValueDataSource::New(value))
@@ -388,7 +406,10 @@ HdSceneIndexPrim _TranslateVolume(
 
 ///////////////////////////////////////////////////////////////////////////////
 // A data source wrapping a prim. When "primvars" is requested we overlay a
-// rewritten primvars container; other fields pass through untouched.
+// rewritten primvars container; other fields pass through untouched. The
+// rewritten container is built on the first request and reused by the later
+// requests on the same data source. GetPrim wraps a new data source each time,
+// so consumers querying the primvars repeatedly should hold on to it.
 ///////////////////////////////////////////////////////////////////////////////
 class _MtoaPrimvarRemapDataSource : public HdContainerDataSource {
 public:
@@ -401,13 +422,19 @@ public:
         if (!_inputPrimDs) {
             return nullptr;
         }
-        HdDataSourceBaseHandle result = _inputPrimDs->Get(name);
-        if (name == HdPrimvarsSchemaTokens->primvars) {
-            if (HdPrimvarsSchema primvars = HdPrimvarsSchema::GetFromParent(_inputPrimDs)) {
-                return _RemapPrimvars(primvars);
+        if (name != HdPrimvarsSchemaTokens->primvars) {
+            return _inputPrimDs->Get(name);
+        }
+        std::lock_guard<std::mutex> guard(_primvarsMutex);
+        if (!_primvarsRemapped) {
+            HdDataSourceBaseHandle primvarsDs = _inputPrimDs->Get(name);
+            if (HdPrimvarsSchema primvars{HdContainerDataSource::Cast(primvarsDs)}) {
+                primvarsDs = _RemapPrimvars(primvars);
             }
+            _primvars = primvarsDs;
+            _primvarsRemapped = true;
         }
-        return result;
+        return _primvars;
     }
 
 private:
@@ -415,12 +442,18 @@ private:
 
     HdDataSourceBaseHandle _RemapPrimvars(HdPrimvarsSchema primvars)
     {
+        const TfTokenVector primvarNames = primvars.GetPrimvarNames();
+        if (std::all_of(primvarNames.begin(), primvarNames.end(),
+                [](const TfToken& name) { return _GetMtoaRemappedName(name).IsEmpty(); })) {
+            // Most primvars don't come from MtoA, no need to edit the container.
+            return primvars.GetContainer();
+        }
         HdContainerDataSourceEditor editor(primvars.GetContainer());
-        for (const TfToken& name : primvars.GetPrimvarNames()) {
-            if (!_IsMtoaAiName(name)) {
+        for (const TfToken& name : primvarNames) {
+            const TfToken& remapped = _GetMtoaRemappedName(name);
+            if (remapped.IsEmpty()) {
                 continue;
             }
-            const TfToken remapped = _RemapMtoaAiName(name);
             // If a primvar already exists at the target name, leave it alone
             // rather than stomping on an authored value.
             if (primvars.GetPrimvar(remapped)) {
@@ -440,6 +473,9 @@ private:
     }
 
     HdContainerDataSourceHandle _inputPrimDs;
+    std::mutex _primvarsMutex;
+    HdDataSourceBaseHandle _primvars;
+    bool _primvarsRemapped = false;
 };
 
 TF_DECLARE_REF_PTRS(_MtoaSceneIndex);
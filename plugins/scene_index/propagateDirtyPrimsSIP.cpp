@@ -2,8 +2,11 @@
 #ifdef ENABLE_SCENE_INDEX
 #include <pxr/imaging/hd/retainedDataSource.h>
 #include <pxr/imaging/hd/sceneIndexPluginRegistry.h>
+#include <pxr/imaging/hd/sceneIndexPrimView.h>
 #include "constant_strings.h"
 
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 PropagateDirtyPrimsSceneIndexRefPtr PropagateDirtyPrimsSceneIndex::New(const HdSceneIndexBaseRefPtr &inputSceneIndex)
@@ -32,11 +35,41 @@ PropagateDirtyPrimsSceneIndex::PropagateDirtyPrimsSceneIndex(const HdSceneIndexB
 #if PXR_VERSION >= 2308
     SetDisplayName("Arnold: propagate dirty prims");
 #endif
+    for (const SdfPath &primPath : HdSceneIndexPrimView(inputSceneIndex)) {
+        _AddPrimType(primPath, inputSceneIndex->GetPrim(primPath).primType);
+    }
+}
+
+void PropagateDirtyPrimsSceneIndex::_AddPrimType(const SdfPath &primPath, const TfToken &primType)
+{
+    // A prim can be added again with a different type
+    for (auto &[type, primPaths] : _primsByType) {
+        if (type != primType) {
+            primPaths.erase(primPath);
+        }
+    }
+    if (!primType.IsEmpty()) {
+        _primsByType[primType].insert(primPath);
+    }
+}
+
+void PropagateDirtyPrimsSceneIndex::_RemovePrims(const SdfPath &primPath)
+{
+    // The descendants of a path directly follow it in a SdfPathSet
+    for (auto &[type, primPaths] : _primsByType) {
+        auto it = primPaths.lower_bound(primPath);
+        while (it != primPaths.end() && it->HasPrefix(primPath)) {
+            it = primPaths.erase(it);
+        }
+    }
 }
 
 void PropagateDirtyPrimsSceneIndex::_PrimsAdded(
     const HdSceneIndexBase &sender, const HdSceneIndexObserver::AddedPrimEntries &entries)
 {
+    for (const auto &entry : entries) {
+        _AddPrimType(entry.primPath, entry.primType);
+    }
     if (!_IsObserved()) {
         return;
     }
@@ -47,6 +80,9 @@ void PropagateDirtyPrimsSceneIndex::_PrimsAdded(
 void PropagateDirtyPrimsSceneIndex::_PrimsRemoved(
     const HdSceneIndexBase &sender, const HdSceneIndexObserver::RemovedPrimEntries &entries)
 {
+    for (const auto &entry : entries) {
+        _RemovePrims(entry.primPath);
+    }
     if (!_IsObserved()) {
         return;
     }
@@ -65,16 +101,36 @@ void PropagateDirtyPrimsSceneIndex::_PrimsDirtied(
 void PropagateDirtyPrimsSceneIndex::_SystemMessage(const TfToken &messageType, const HdDataSourceBaseHandle &args)
 {
     if (messageType == str::t_ArnoldMarkPrimsDirty) {
-        // The type is defined in render_delegate.cpp, ideally we would like a more memory friendly type
-        auto handle =
-            HdRetainedTypedSampledDataSource<TfHashMap<SdfPath, HdDataSourceLocatorSet, SdfPath::Hash>>::Cast(args);
-        if (handle) {
-            TfHashMap<SdfPath, HdDataSourceLocatorSet, SdfPath::Hash> passedEntries =
-                handle->GetTypedValue(0); // Is this a copy ? Oo
-            HdSceneIndexObserver::DirtiedPrimEntries dirtyEntries;
-            for (const auto &[id, locators] : passedEntries) {
-                dirtyEntries.emplace_back(id, locators);
+        // The type is defined in render_delegate.cpp, the entries are shared so only the pointer is copied.
+        using SharedDirtiedPrimEntries = std::shared_ptr<const HdSceneIndexObserver::DirtiedPrimEntries>;
+        if (auto handle = HdTypedSampledDataSource<SharedDirtiedPrimEntries>::Cast(args)) {
+            const SharedDirtiedPrimEntries dirtyEntries = handle->GetTypedValue(0);
+            if (dirtyEntries && !dirtyEntries->empty()) {
+                _SendPrimsDirtied(*dirtyEntries);
+            }
+        }
+    } else if (messageType == str::t_ArnoldMarkRprimTypesDirty) {
+        // The message contains the locators to dirty for each rprim type
+        HdContainerDataSourceHandle primTypesDs = HdContainerDataSource::Cast(args);
+        if (!primTypesDs) {
+            return;
+        }
+        HdSceneIndexObserver::DirtiedPrimEntries dirtyEntries;
+        for (const TfToken &primType : primTypesDs->GetNames()) {
+            const auto primsIt = _primsByType.find(primType);
+            if (primsIt == _primsByType.end()) {
+                continue;
+            }
+            auto locatorsDs = HdTypedSampledDataSource<HdDataSourceLocatorSet>::Cast(primTypesDs->Get(primType));
+            if (!locatorsDs) {
+                continue;
             }
+            const HdDataSourceLocatorSet locators = locatorsDs->GetTypedValue(0);
+            for (const SdfPath &primPath : primsIt->second) {
+                dirtyEntries.emplace_back(primPath, locators);
+            }
+        }
+        if (!dirtyEntries.empty()) {
             _SendPrimsDirtied(dirtyEntries);
         }
     }
@@ -92,7 +148,9 @@ TF_REGISTRY_FUNCTION(TfType) { HdSceneIndexPluginRegistry::Define<HdArnoldPropag
 
 TF_REGISTRY_FUNCTION(HdSceneIndexPlugin)
 {
-    const HdSceneIndexPluginRegistry::InsertionPhase insertionPhase = 0;
+    // Inserted after the filters of phase 0 converting implicit surfaces and nurbs to meshes, so we
+    // see the final type of the rprims.
+    const HdSceneIndexPluginRegistry::InsertionPhase insertionPhase = 1;
 
     HdSceneIndexPluginRegistry::GetInstance().RegisterSceneIndexForRenderer(
         "Arnold", TfToken("HdArnoldPropagateDirtyPrimsSceneIndexPlugin"), nullptr, insertionPhase,
@@ -8,6 +8,8 @@
 #include <pxr/pxr.h>
 #include "api.h"
 
+#include <unordered_map>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DECLARE_REF_PTRS(PropagateDirtyPrimsSceneIndex);
@@ -39,6 +41,13 @@ protected:
         const HdSceneIndexBase &sender, const HdSceneIndexObserver::DirtiedPrimEntries &entries) override;
     HDSCENEINDEX_API
     void _SystemMessage(const TfToken &messageType, const HdDataSourceBaseHandle &args) override;
+
+private:
+    void _AddPrimType(const SdfPath &primPath, const TfToken &primType);
+    void _RemovePrims(const SdfPath &primPath);
+
+    // Paths of the prims of each type, used to dirty all the prims of a type without traversing the scene.
+    std::unordered_map<TfToken, SdfPathSet, TfToken::HashFunctor> _primsByType;
 };
 
 class HdArnoldPropagateDirtyPrimsSceneIndexPlugin : public HdSceneIndexPlugin {
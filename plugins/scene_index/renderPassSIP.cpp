@@ -29,7 +29,7 @@
 #include <pxr/imaging/hd/tokens.h>
 #include <pxr/imaging/hd/version.h>
 #include <pxr/imaging/hd/visibilitySchema.h>
-#include <pxr/imaging/hdsi/utils.h>
+#include <algorithm>
 
 PXR_NAMESPACE_OPEN_SCOPE
 // clang-format off
@@ -99,29 +99,50 @@ static bool _IsVisibleToCamera(const HdContainerDataSourceHandle &primSource)
     return true;
 }
 
+bool HdArnoldRenderPassSceneIndex::_RenderPassState::_Match(
+    const SdfPath &primPath, _Collection collection, const HdCollectionExpressionEvaluator &eval) const
+{
+    if (!(memoizedCollections & collection)) {
+        return eval.Match(primPath);
+    }
+    const uint8_t evaluated = collection << 4;
+    {
+        std::shared_lock<std::shared_mutex> lock(matchCache->mutex);
+        const auto it = matchCache->table.find(primPath);
+        if (it != matchCache->table.end() && (it->second & evaluated)) {
+            return it->second & collection;
+        }
+    }
+    // Evaluate without holding the lock.
+    const bool match = eval.Match(primPath);
+    std::unique_lock<std::shared_mutex> lock(matchCache->mutex);
+    matchCache->table[primPath] |= evaluated | (match ? collection : 0);
+    return match;
+}
+
 bool HdArnoldRenderPassSceneIndex::_RenderPassState::DoesOverrideMatte(
     SdfPath const &primPath, HdSceneIndexPrim const &prim) const
 {
-    return matteEval && _IsGeometryType(prim.primType) && matteEval->Match(primPath);
+    return matteEval && _IsGeometryType(prim.primType) && _Match(primPath, Matte, *matteEval);
 }
 
 bool HdArnoldRenderPassSceneIndex::_RenderPassState::DoesOverrideVis(
     SdfPath const &primPath, HdSceneIndexPrim const &prim) const
 {
-    return renderVisEval && _ShouldApplyPassVisibility(prim.primType) && !renderVisEval->Match(primPath) &&
-           _IsVisible(prim.dataSource);
+    return renderVisEval && _ShouldApplyPassVisibility(prim.primType) &&
+           !_Match(primPath, RenderVis, *renderVisEval) && _IsVisible(prim.dataSource);
 }
 
 bool HdArnoldRenderPassSceneIndex::_RenderPassState::DoesOverrideCameraVis(
     SdfPath const &primPath, HdSceneIndexPrim const &prim) const
 {
-    return cameraVisEval && _ShouldApplyPassVisibility(prim.primType) && !cameraVisEval->Match(primPath) &&
-           _IsVisibleToCamera(prim.dataSource);
+    return cameraVisEval && _ShouldApplyPassVisibility(prim.primType) &&
+           !_Match(primPath, CameraVis, *cameraVisEval) && _IsVisibleToCamera(prim.dataSource);
 }
 
 bool HdArnoldRenderPassSceneIndex::_RenderPassState::DoesPrune(SdfPath const &primPath) const
 {
-    return pruneEval && pruneEval->Match(primPath);
+    return pruneEval && _Match(primPath, Prune, *pruneEval);
 }
 
 HdSceneIndexPrim HdArnoldRenderPassSceneIndex::GetPrim(const SdfPath &primPath) const
@@ -199,7 +220,11 @@ SdfPathVector HdArnoldRenderPassSceneIndex::GetChildPrimPaths(const SdfPath &pri
 {
     if (_activeRenderPass.pruneEval) {
         SdfPathVector childPathVec = _GetInputSceneIndex()->GetChildPrimPaths(primPath);
-        HdsiUtilsRemovePrunedChildren(primPath, *_activeRenderPass.pruneEval, &childPathVec);
+        childPathVec.erase(
+            std::remove_if(
+                childPathVec.begin(), childPathVec.end(),
+                [this](const SdfPath &childPath) { return _activeRenderPass.DoesPrune(childPath); }),
+            childPathVec.end());
         return childPathVec;
     } else {
         return _GetInputSceneIndex()->GetChildPrimPaths(primPath);
@@ -247,18 +272,17 @@ inline static bool _EntryCouldAffectPass(const ENTRIES &entries, SdfPath const &
 // Helper to apply pruning to an entry list.
 // Returns true if any pruning was applied, putting surviving entries
 // into *postPruneEntries.
-template <typename ENTRIES>
-inline static bool _PruneEntries(
-    std::optional<HdCollectionExpressionEvaluator> &pruneEval, const ENTRIES &entries, ENTRIES *postPruneEntries)
+template <typename STATE, typename ENTRIES>
+inline static bool _PruneEntries(const STATE &state, const ENTRIES &entries, ENTRIES *postPruneEntries)
 {
-    if (!pruneEval) {
+    if (!state.pruneEval) {
         // No pruning active.
         return false;
     }
     // Pre-pass to see if any prune applies to the list.
     bool foundEntryToPrune = false;
     for (const auto &entry : entries) {
-        if (pruneEval->Match(entry.primPath)) {
+        if (state.DoesPrune(entry.primPath)) {
             foundEntryToPrune = true;
             break;
         }
@@ -269,7 +293,7 @@ inline static bool _PruneEntries(
     } else {
         // Prune matching entries.
         for (const auto &entry : entries) {
-            if (!pruneEval->Match(entry.primPath)) {
+            if (!state.DoesPrune(entry.primPath)) {
                 // Accumulate survivors.
                 postPruneEntries->push_back(entry);
             }
@@ -291,7 +315,7 @@ void HdArnoldRenderPassSceneIndex::_PrimsAdded(
     }
 
     // Filter entries against any active render pass prune collection.
-    if (!_PruneEntries(_activeRenderPass.pruneEval, entries, &extraAddedEntries)) {
+    if (!_PruneEntries(_activeRenderPass, entries, &extraAddedEntries)) {
         _SendPrimsAdded(entries);
     }
 
@@ -313,10 +337,22 @@ void HdArnoldRenderPassSceneIndex::_PrimsRemoved(
     }
 
     // Filter entries against any active render pass prune collection.
-    if (!_PruneEntries(_activeRenderPass.pruneEval, entries, &extraRemovedEntries)) {
+    if (!_PruneEntries(_activeRenderPass, entries, &extraRemovedEntries)) {
         _SendPrimsRemoved(entries);
     }
 
+    // Forget what was evaluated for the removed subtrees, so the cache doesn't keep growing.
+    {
+        std::unique_lock<std::shared_mutex> lock(_activeRenderPass.matchCache->mutex);
+        SdfPathTable<uint8_t> &table = _activeRenderPass.matchCache->table;
+        if (!table.empty()) {
+            for (const auto &entry : entries) {
+                // Erasing a path from the table erases its descendants as well
+                table.erase(entry.primPath);
+            }
+        }
+    }
+
     _SendPrimsAdded(extraAddedEntries);
     _SendPrimsRemoved(extraRemovedEntries);
     _SendPrimsDirtied(extraDirtyEntries);
@@ -335,7 +371,7 @@ void HdArnoldRenderPassSceneIndex::_PrimsDirtied(
     }
 
     // Filter entries against any active render pass prune collection.
-    if (!_PruneEntries(_activeRenderPass.pruneEval, entries, &extraDirtyEntries)) {
+    if (!_PruneEntries(_activeRenderPass, entries, &extraDirtyEntries)) {
         _SendPrimsDirtied(entries);
     }
 
@@ -346,6 +382,21 @@ void HdArnoldRenderPassSceneIndex::_PrimsDirtied(
 
 HdArnoldRenderPassSceneIndex::~HdArnoldRenderPassSceneIndex() = default;
 
+// Returns true if the expression only depends on prim paths, so its evaluations can be memoized.
+static bool _IsPathOnlyExpression(const SdfPathExpression &expr)
+{
+    bool pathOnly = true;
+    expr.Walk(
+        [](SdfPathExpression::Op, int) {},
+        [&pathOnly](const SdfPathExpression::ExpressionReference &) { pathOnly = false; },
+        [&pathOnly](const SdfPathExpression::PathPattern &pattern) {
+            if (!pattern.GetPredicateExprs().empty()) {
+                pathOnly = false;
+            }
+        });
+    return pathOnly;
+}
+
 // Helper method to compile a collection evaluator.
 static void _CompileCollection(
     HdCollectionsSchema &collections, TfToken const &collectionName, HdSceneIndexBaseRefPtr const &sceneIndex,
@@ -392,6 +443,15 @@ void HdArnoldRenderPassSceneIndex::_UpdateActiveRenderPassState(
             _CompileCollection(
                 collections, _tokens->cameraVisibility, inputSceneIndex, &state.cameraVisExpr, &state.cameraVisEval);
             _CompileCollection(collections, _tokens->prune, inputSceneIndex, &state.pruneExpr, &state.pruneEval);
+            for (const auto &collection :
+                 {std::make_pair(&state.matteExpr, _RenderPassState::Matte),
+                  std::make_pair(&state.renderVisExpr, _RenderPassState::RenderVis),
+                  std::make_pair(&state.cameraVisExpr, _RenderPassState::CameraVis),
+                  std::make_pair(&state.pruneExpr, _RenderPassState::Prune)}) {
+                if (!collection.first->IsEmpty() && _IsPathOnlyExpression(*collection.first)) {
+                    state.memoizedCollections |= collection.second;
+                }
+            }
         }
     }
 
@@ -412,7 +472,9 @@ void HdArnoldRenderPassSceneIndex::_UpdateActiveRenderPassState(
     // should be used here instead, since in the future it will handle
     // instance matches as well as parallel traversal.
     //
-    for (const SdfPath &path : HdSceneIndexPrimView(_GetInputSceneIndex())) {
+    const HdSceneIndexPrimView primView(_GetInputSceneIndex());
+    for (auto it = primView.begin(); it != primView.end(); ++it) {
+        const SdfPath &path = *it;
         if (priorState.DoesPrune(path)) {
             // The prim had been pruned.
             if (!state.DoesPrune(path)) {
@@ -420,11 +482,13 @@ void HdArnoldRenderPassSceneIndex::_UpdateActiveRenderPassState(
                 HdSceneIndexPrim prim = _GetInputSceneIndex()->GetPrim(path);
                 addedEntries->push_back({path, prim.primType});
             } else {
-                // The prim is still pruned, so nothing to do.
+                // The prim is still pruned, so is its whole subtree.
+                it.SkipDescendants();
             }
         } else if (state.DoesPrune(path)) {
-            // The prim is newly pruned, so remove it.
+            // The prim is newly pruned, so remove it. Removing a prim removes its descendants.
             removedEntries->push_back({path});
+            it.SkipDescendants();
         } else if (visOrMatteExprDidChange) {
             // Determine which (if any) locators on the upstream prim
             // are dirtied by the change in render pass state.
@@ -11,10 +11,14 @@
 #include <pxr/pxr.h>
 
 #ifdef ENABLE_SCENE_INDEX
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <shared_mutex>
 #include <pxr/imaging/hd/collectionExpressionEvaluator.h>
 #include <pxr/imaging/hd/filteringSceneIndex.h>
 #include <pxr/imaging/hd/sceneIndexPlugin.h>
+#include <pxr/usd/sdf/pathTable.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -42,6 +46,14 @@ protected:
         const HdSceneIndexBase &sender, const HdSceneIndexObserver::DirtiedPrimEntries &entries) override;
 
 private:
+    // Results of the collection evaluators for each queried prim path. For every
+    // collection, the high bits store if it was evaluated and the low bits if it matched.
+    // A path table is used so that removed subtrees can be erased without a full scan.
+    struct _MatchCache {
+        mutable std::shared_mutex mutex;
+        SdfPathTable<uint8_t> table;
+    };
+
     // State specified by a render pass.
     // If renderPassPath is the empty path, no render pass is active.
     // Collection evaluators are set sparsely, corresponding to
@@ -65,6 +77,18 @@ private:
         bool DoesOverrideVis(const SdfPath &primPath, HdSceneIndexPrim const &prim) const;
         bool DoesOverrideCameraVis(const SdfPath &primPath, HdSceneIndexPrim const &prim) const;
         bool DoesPrune(const SdfPath &primPath) const;
+
+        enum _Collection : uint8_t { Matte = 1, RenderVis = 1 << 1, CameraVis = 1 << 2, Prune = 1 << 3 };
+
+        // Downstream scene indices call GetPrim several times for the same paths, so the
+        // evaluations are memoized. Only the collections whose expressions depend on the prim
+        // paths alone are memoized, predicates like hdType or hasPrimvar read prim data that can
+        // change. The cache lives as long as this state, which is rebuilt when the active render
+        // pass or its collections change, and removed prims are evicted from it.
+        std::unique_ptr<_MatchCache> matchCache = std::make_unique<_MatchCache>();
+        uint8_t memoizedCollections = 0;
+
+        bool _Match(const SdfPath &primPath, _Collection collection, const HdCollectionExpressionEvaluator &eval) const;
     };
 
     // Pull on the scene globals schema for the active render pass,
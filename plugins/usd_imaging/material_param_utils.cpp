@@ -42,7 +42,12 @@
 
 #if PXR_VERSION >= 2108
 
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/stringUtils.h>
 
 #include <pxr/imaging/hd/material.h>
 
@@ -50,12 +55,14 @@
 #include <pxr/usd/ar/resolver.h>
 
 #include <pxr/usd/sdf/layerUtils.h>
+#include <pxr/usd/sdf/notice.h>
 
 #include <pxr/usd/sdr/registry.h>
 #include <pxr/usd/sdr/shaderNode.h>
 #include <pxr/usd/sdr/shaderProperty.h>
 
 #include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/stage.h>
 
 #include <pxr/usd/usdShade/connectableAPI.h>
 #include <pxr/usd/usdShade/nodeDefAPI.h>
@@ -65,10 +72,20 @@
 #endif
 #include <pxr/usd/usdLux/lightFilter.h>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    USDIMAGINGARNOLD_UDIM_DIRECTORY_LISTING, true,
+    "Find the first UDIM tile by listing its directory once, instead of resolving each tile.");
+
 namespace {
 
 const char UDIM_PATTERN[] = "<UDIM>";
@@ -88,19 +105,101 @@ SdfLayerHandle _FindLayerHandle(const UsdAttribute& attr, const UsdTimeCode& tim
     return TfNullPtr;
 }
 
+// Process wide cache of the filesystem queries done while resolving texture
+// parameters. The same textures and UDIM patterns are used by many shaders, and
+// materials are populated from multiple threads. It is cleared when a layer is
+// reloaded, which is when textures written since the first resolution are expected
+// to be picked up.
+class _ResolutionCache : public TfWeakBase {
+public:
+    static _ResolutionCache& GetInstance()
+    {
+        static _ResolutionCache instance;
+        return instance;
+    }
+
+    // Returns true and sets value if the key was found in the given map.
+    bool Find(const std::unordered_map<std::string, std::string>& map, const std::string& key, std::string* value)
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        const auto it = map.find(key);
+        if (it == map.end()) {
+            return false;
+        }
+        *value = it->second;
+        return true;
+    }
+
+    void Insert(std::unordered_map<std::string, std::string>& map, const std::string& key, const std::string& value)
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        map.emplace(key, value);
+    }
+
+    // Returns the names of the files in a directory, listed only once.
+    // Returns nullptr if the directory can't be read.
+    std::shared_ptr<const std::unordered_set<std::string>> GetDirectoryListing(const std::string& dirPath)
+    {
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            const auto it = _directories.find(dirPath);
+            if (it != _directories.end()) {
+                return it->second;
+            }
+        }
+        std::shared_ptr<std::unordered_set<std::string>> listing;
+        std::vector<std::string> dirNames, fileNames, symlinkNames;
+        std::string error;
+        if (TfIsDir(dirPath) && TfReadDir(dirPath, &dirNames, &fileNames, &symlinkNames, &error)) {
+            listing = std::make_shared<std::unordered_set<std::string>>(fileNames.begin(), fileNames.end());
+            listing->insert(symlinkNames.begin(), symlinkNames.end());
+        }
+        std::lock_guard<std::mutex> guard(_mutex);
+        return _directories.emplace(dirPath, listing).first->second;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        realPaths.clear();
+        firstTiles.clear();
+        _directories.clear();
+    }
+
+    // Real paths of resolved assets, empty if the path couldn't be resolved.
+    std::unordered_map<std::string, std::string> realPaths;
+    // First tile of UDIM patterns, keyed by resolver context, layer and pattern.
+    std::unordered_map<std::string, std::string> firstTiles;
+
+private:
+    _ResolutionCache() { TfNotice::Register(TfCreateWeakPtr(this), &_ResolutionCache::_OnLayerDidReloadContent); }
+
+    void _OnLayerDidReloadContent(const SdfNotice::LayerDidReloadContent& notice)
+    {
+        TF_UNUSED(notice);
+        Clear();
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::shared_ptr<const std::unordered_set<std::string>>> _directories;
+};
+
 // Resolve symlinks for string path.
 // Resolving symlinks can reduce the number of unique textures added into the
 // texture registry since it may use the asset path as hash.
 bool _ResolveSymlinks(const std::string& srcPath, std::string* outPath)
 {
-    std::string error;
-    *outPath = TfRealPath(srcPath, false, &error);
-
-    if (outPath->empty() || !error.empty()) {
-        return false;
+    _ResolutionCache& cache = _ResolutionCache::GetInstance();
+    if (!cache.Find(cache.realPaths, srcPath, outPath)) {
+        std::string error;
+        *outPath = TfRealPath(srcPath, false, &error);
+        if (!error.empty()) {
+            outPath->clear();
+        }
+        cache.Insert(cache.realPaths, srcPath, *outPath);
     }
 
-    return true;
+    return !outPath->empty();
 }
 
 // Resolve symlinks for asset path.
@@ -120,30 +219,72 @@ SdfAssetPath _ResolveAssetSymlinks(const SdfAssetPath& assetPath)
     }
 }
 
+// Looks for the first UDIM tile in the directory of an anchored tile path
+// (e.g., /someDir/myImage.1001.exr), listing the directory only once.
+// Returns false if the directory can't be listed, in which case the tiles
+// have to be resolved one by one.
+bool _FindFirstTileInDirectory(
+    const std::string& anchoredTilePath, const std::string& suffix, std::string* firstTilePath)
+{
+    if (!TfGetEnvSetting(USDIMAGINGARNOLD_UDIM_DIRECTORY_LISTING) || TfIsRelativePath(anchoredTilePath) ||
+        ArIsPackageRelativePath(anchoredTilePath) || suffix.find_first_of("/\\") != std::string::npos ||
+        !TfStringEndsWith(anchoredTilePath, std::to_string(UDIM_START_TILE) + suffix)) {
+        return false;
+    }
+    const std::string::size_type prefixLength = anchoredTilePath.size() - suffix.size() - UDIM_TILE_NUMBER_LENGTH;
+    const std::string::size_type separator = anchoredTilePath.find_last_of("/\\", prefixLength);
+    if (separator == std::string::npos) {
+        return false;
+    }
+    const std::string dirPath = anchoredTilePath.substr(0, separator + 1);
+    const auto listing = _ResolutionCache::GetInstance().GetDirectoryListing(dirPath);
+    if (!listing) {
+        return false;
+    }
+    const std::string fileNamePrefix = anchoredTilePath.substr(separator + 1, prefixLength - separator - 1);
+    firstTilePath->clear();
+    for (int i = UDIM_START_TILE; i < UDIM_END_TILE; i++) {
+        const std::string fileName = fileNamePrefix + std::to_string(i) + suffix;
+        if (listing->count(fileName)) {
+            *firstTilePath = ArGetResolver().Resolve(dirPath + fileName);
+            break;
+        }
+    }
+    return true;
+}
+
 // Given the prefix (e.g., /someDir/myImage.) and suffix (e.g., .exr),
-// add integer between them and try to resolve. Iterate until
-// resolution succeeded.
+// returns the first tile found in the directory of the pattern, or the
+// resolved path of tile 1001 if the directory can't be listed.
 std::string _ResolvedPathForFirstTile(const std::pair<std::string, std::string>& splitPath, SdfLayerHandle const& layer)
 {
     TRACE_FUNCTION();
 
+    // The resolution depends on the bound resolver context and on the layer anchoring relative paths
     ArResolver& resolver = ArGetResolver();
+    const std::string cacheKey = TfStringPrintf("%zu|%s|%s<UDIM>%s", hash_value(resolver.GetCurrentContext()),
+        layer ? layer->GetIdentifier().c_str() : "", splitPath.first.c_str(), splitPath.second.c_str());
+    _ResolutionCache& cache = _ResolutionCache::GetInstance();
+    std::string firstTilePath;
+    if (cache.Find(cache.firstTiles, cacheKey, &firstTilePath)) {
+        return firstTilePath;
+    }
 
-    for (int i = UDIM_START_TILE; i < UDIM_END_TILE; i++) {
-        // Fill in integer
-        std::string path = splitPath.first + std::to_string(i) + splitPath.second;
-        if (layer) {
-            // Deal with layer-relative paths.
-            path = SdfComputeAssetPathRelativeToLayer(layer, path);
-        }
-        // Resolve. Unlike the non-UDIM case, we do not resolve symlinks
-        // here to handle the case where the symlinks follow the UDIM
-        // naming pattern but the files that are linked do not. We'll
-        // let whoever consumes the pattern determine if they want to
-        // resolve symlinks themselves.
-        return resolver.Resolve(path);
-    }
-    return std::string();
+    std::string path = splitPath.first + std::to_string(UDIM_START_TILE) + splitPath.second;
+    if (layer) {
+        // Deal with layer-relative paths.
+        path = SdfComputeAssetPathRelativeToLayer(layer, path);
+    }
+    // Resolve. Unlike the non-UDIM case, we do not resolve symlinks
+    // here to handle the case where the symlinks follow the UDIM
+    // naming pattern but the files that are linked do not. We'll
+    // let whoever consumes the pattern determine if they want to
+    // resolve symlinks themselves.
+    if (!_FindFirstTileInDirectory(path, splitPath.second, &firstTilePath)) {
+        firstTilePath = resolver.Resolve(path);
+    }
+    cache.Insert(cache.firstTiles, cacheKey, firstTilePath);
+    return firstTilePath;
 }
 
 // Split a udim file path such as /someDir/myFile.<UDIM>.exr into a
@@ -402,6 +543,67 @@ void _WalkGraph(
     materialNetwork->nodes.push_back(node);
 }
 
+// Process wide cache of the time variability of shading nodes and their upstream
+// graph. Node graphs are often shared between many materials, and the cache avoids
+// walking them and querying the time samples of their inputs for each material.
+// Any layer change can modify the time samples or the connections, so the whole
+// cache is cleared when layers change.
+class _TimeVaryingCache : public TfWeakBase {
+public:
+    static _TimeVaryingCache& GetInstance()
+    {
+        static _TimeVaryingCache instance;
+        return instance;
+    }
+
+    // Returns true and sets isTimeVarying if the node was found in the cache.
+    bool Find(UsdShadeConnectableAPI const& shadeNode, bool* isTimeVarying)
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        const auto it = _nodes.find(shadeNode.GetPath());
+        if (it == _nodes.end()) {
+            return false;
+        }
+        // The same path can exist in multiple stages
+        for (const auto& entry : it->second) {
+            if (entry.first && entry.first == shadeNode.GetPrim().GetStage()) {
+                *isTimeVarying = entry.second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Insert(UsdShadeConnectableAPI const& shadeNode, bool isTimeVarying)
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        auto& entries = _nodes[shadeNode.GetPath()];
+        // Remove the entries of the stages that were destroyed
+        entries.erase(
+            std::remove_if(
+                entries.begin(), entries.end(),
+                [](const std::pair<UsdStageWeakPtr, bool>& entry) { return !entry.first; }),
+            entries.end());
+        entries.emplace_back(shadeNode.GetPrim().GetStage(), isTimeVarying);
+    }
+
+private:
+    _TimeVaryingCache()
+    {
+        TfNotice::Register(TfCreateWeakPtr(this), &_TimeVaryingCache::_OnLayersDidChange);
+    }
+
+    void _OnLayersDidChange(const SdfNotice::LayersDidChange& notice)
+    {
+        TF_UNUSED(notice);
+        std::lock_guard<std::mutex> guard(_mutex);
+        _nodes.clear();
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<SdfPath, std::vector<std::pair<UsdStageWeakPtr, bool>>, SdfPath::Hash> _nodes;
+};
+
 bool _IsGraphTimeVarying(UsdShadeConnectableAPI const& shadeNode, _PathSet* visitedNodes)
 {
     // Store the path of the node
@@ -415,6 +617,13 @@ bool _IsGraphTimeVarying(UsdShadeConnectableAPI const& shadeNode, _PathSet* visi
         return false;
     }
 
+    // Nodes shared with previously checked materials don't need to be walked again
+    _TimeVaryingCache& cache = _TimeVaryingCache::GetInstance();
+    bool isTimeVarying = false;
+    if (cache.Find(shadeNode, &isTimeVarying)) {
+        return isTimeVarying;
+    }
+
     // Visit the inputs of this node to ensure they are emitted first.
     const std::vector<UsdShadeInput> shadeNodeInputs = shadeNode.GetInputs();
     for (UsdShadeInput input : shadeNodeInputs) {
@@ -427,21 +636,26 @@ bool _IsGraphTimeVarying(UsdShadeConnectableAPI const& shadeNode, _PathSet* visi
             // If it is an output on a shading node we visit the node and also
             // create a relationship in the network
             if (_IsGraphTimeVarying(UsdShadeConnectableAPI(attr.GetPrim()), visitedNodes)) {
-                return true;
+                isTimeVarying = true;
+                break;
             }
         } else if (attrType == UsdShadeAttributeType::Input) {
             // If it is an input attribute we get the authored value.
             if (attr.ValueMightBeTimeVarying()) {
-                return true;
+                isTimeVarying = true;
+                break;
             }
         }
     }
 
-    return false;
+    cache.Insert(shadeNode, isTimeVarying);
+    return isTimeVarying;
 }
 
 } // namespace
 
+void UsdImagingArnoldClearMaterialParamCache() { _ResolutionCache::GetInstance().Clear(); }
+
 VtValue UsdImagingArnoldResolveMaterialParamValue(const UsdAttribute& attr, const UsdTimeCode& time)
 {
     TRACE_FUNCTION();
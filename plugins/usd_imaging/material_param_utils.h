@@ -64,9 +64,18 @@ class VtValue;
 ///
 /// The function assumes that the correct ArResolverContext is bound.
 ///
+/// Symlinks and UDIM patterns are resolved once per process, and the results are
+/// cached until a layer is reloaded, see UsdImagingArnoldClearMaterialParamCache.
+///
 USDIMAGINGARNOLD_API
 VtValue UsdImagingArnoldResolveMaterialParamValue(const UsdAttribute& attr, const UsdTimeCode& time);
 
+/// Clears the cached resolution of texture paths, so that files created or
+/// removed since the first resolution are taken into account. This is done
+/// automatically when a layer is reloaded.
+USDIMAGINGARNOLD_API
+void UsdImagingArnoldClearMaterialParamCache();
+
 /// Builds an HdMaterialNetwork for the usdTerminal prim and
 /// populates it in the materialNetworkMap under the terminalIdentifier.
 /// This shared implementation is usable for populating material networks for
@@ -170,11 +170,16 @@ void ArnoldNodeGraphAdapter::TrackVariability(
 {
     TF_UNUSED(instancerContext);
     TF_UNUSED(cachePath);
-    // TODO: This is checking for the connected parameters on the primitive, which is not exactly what we want.
-    // So it would be better to check all the terminals, check for their time variability.
-    // if (UsdImagingArnoldIsHdMaterialNetworkTimeVarying(prim)) {
-    //     *timeVaryingBits |= HdMaterial::DirtyResource;
-    // }
+    // Check the terminals used by GetMaterialResource. The variability of the shading
+    // nodes is cached, so node graphs shared between materials are only walked once.
+    UsdShadeConnectableAPI connectableAPI(prim);
+    for (const auto& output : connectableAPI.GetOutputs(true)) {
+        const auto sources = output.GetConnectedSources();
+        if (!sources.empty() && UsdImagingArnoldIsHdMaterialNetworkTimeVarying(sources[0].source.GetPrim())) {
+            *timeVaryingBits |= HdMaterial::DirtyResource;
+            return;
+        }
+    }
 }
 
 VtValue ArnoldNodeGraphAdapter::GetMaterialResource(
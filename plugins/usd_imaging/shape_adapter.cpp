@@ -59,7 +59,7 @@ void UsdImagingArnoldShapeAdapter::TrackVariability(
     BaseAdapter::TrackVariability(prim, cachePath, timeVaryingBits, instancerContext);
 
     for (const auto& attribute : prim.GetAttributes()) {
-        if (TfStringStartsWith(attribute.GetName().GetString(), str::arnold_prefix)) {
+        if (_IsParamName(attribute.GetName())) {
             _IsVarying(
                 prim, attribute.GetName(), ArnoldUsdRprimBitsParams, UsdImagingTokens->usdVaryingPrimvar,
                 timeVaryingBits, false);
@@ -70,9 +70,17 @@ void UsdImagingArnoldShapeAdapter::TrackVariability(
 HdDirtyBits UsdImagingArnoldShapeAdapter::ProcessPropertyChange(
     const UsdPrim& prim, const SdfPath& cachePath, const TfToken& property)
 {
-    return TfStringStartsWith(property.GetString(), str::arnold_prefix)
-               ? ArnoldUsdRprimBitsParams
-               : BaseAdapter::ProcessPropertyChange(prim, cachePath, property);
+    if (!TfStringStartsWith(property.GetString(), str::arnold_prefix))
+        return BaseAdapter::ProcessPropertyChange(prim, cachePath, property);
+    // Arnold attributes that are not part of the schema are never read, so they don't dirty the parameters
+    return _IsParamName(property) ? ArnoldUsdRprimBitsParams : HdChangeTracker::Clean;
+}
+
+bool UsdImagingArnoldShapeAdapter::_IsParamName(const TfToken& name) const
+{
+    return std::any_of(_paramNames.cbegin(), _paramNames.cend(), [&name](const ParamNamesT::value_type& paramName) {
+        return paramName.first == name;
+    });
 }
 
 VtValue UsdImagingArnoldShapeAdapter::Get(
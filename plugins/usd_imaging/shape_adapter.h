@@ -82,6 +82,11 @@ public:
         const UsdPrim& prim, const SdfPath& cachePath, const TfToken& key, UsdTimeCode time,
         VtIntArray* outIndices) const override;
 private:
+    /// Returns true if the USD attribute is one of the parameters read by Get.
+    ///
+    /// @param name Name of the USD attribute.
+    bool _IsParamName(const TfToken& name) const;
+
     ParamNamesT _paramNames; ///< Lookup table with USD and Arnold param names.
 protected:
     /// Caches param names for later lookup.
@@ -0,0 +1,79 @@
+// The usd procedural saves its translated nodes to the directory pointed by PROCEDURAL_SNAPSHOT_CACHE.
+// A second procedural reading the same file must load them back from the snapshot, and get the same
+// Arnold scene as the first one.
+#include <ai.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+
+bool g_snapshotLoaded = false;
+
+void MessageCallback(int logmask, int severity, const char* msg, AtParamValueMap* metadata, void* userPtr)
+{
+   if (msg && strstr(msg, "loaded snapshot"))
+      g_snapshotLoaded = true;
+}
+
+// Expands a usd procedural reading scene.usda in a new universe, and returns the number of
+// polygons of the translated mesh, or -1 if it wasn't found
+int ExpandProcedural()
+{
+   AtUniverse* universe = AiUniverse();
+   AtNode* proc = AiNode(universe, AtString("usd"), AtString("proc"));
+   AiNodeSetStr(proc, AtString("filename"), AtString("scene.usda"));
+
+   // The free render mode initializes the scene, and therefore expands the procedurals,
+   // without rendering any pixel
+   AtRenderSession* session = AiRenderSession(universe);
+   AiRender(session, AI_RENDER_MODE_FREE);
+
+   int numPolygons = -1;
+   AtNode* mesh = AiNodeLookUpByName(universe, AtString("/mesh"), proc);
+   if (mesh) {
+      AtArray* nsides = AiNodeGetArray(mesh, AtString("nsides"));
+      numPolygons = nsides ? (int)AiArrayGetNumElements(nsides) : 0;
+   }
+   AiRenderSessionDestroy(session);
+   AiUniverseDestroy(universe);
+   return numPolygons;
+}
+
+} // namespace
+
+int main(int, char**)
+{
+   // Start from an empty cache, the snapshots of a previous run (or of another testsuite pass
+   // running in the same directory) would be loaded by the first expansion
+   std::error_code error;
+   std::filesystem::remove_all("snapshots", error);
+#ifdef _WIN32
+   _putenv_s("PROCEDURAL_SNAPSHOT_CACHE", "snapshots");
+#else
+   setenv("PROCEDURAL_SNAPSHOT_CACHE", "snapshots", 1);
+#endif
+   AiBegin(AI_SESSION_BATCH);
+   AiMsgRegisterCallback(MessageCallback, AI_LOG_INFO, nullptr);
+
+   const int translatedPolygons = ExpandProcedural();
+   bool success = true;
+   if (translatedPolygons != 6 || g_snapshotLoaded) {
+      AiMsgError("The first procedural expansion should translate the usd file");
+      success = false;
+   }
+
+   const int snapshotPolygons = ExpandProcedural();
+   if (!g_snapshotLoaded) {
+      AiMsgError("The second procedural expansion should load the snapshot");
+      success = false;
+   }
+   if (snapshotPolygons != translatedPolygons) {
+      AiMsgError("The snapshot mesh has %d polygons instead of %d", snapshotPolygons, translatedPolygons);
+      success = false;
+   }
+
+   AiEnd();
+   return success ? 0 : -1;
+}
@@ -0,0 +1,46 @@
+// When ARNOLD_USD_PROFILE is set, the usd procedural writes the statistics of the translation
+// to the given json file, with the time spent in each reader phase and for each prim type.
+// Prim types are only reported by the usd reader, so the test forces it in the hydra passes too.
+#include <ai.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+int main(int, char**)
+{
+#ifdef _WIN32
+   _putenv_s("ARNOLD_USD_PROFILE", "profile.json");
+   _putenv_s("PROCEDURAL_USE_HYDRA", "0");
+#else
+   setenv("ARNOLD_USD_PROFILE", "profile.json", 1);
+   setenv("PROCEDURAL_USE_HYDRA", "0", 1);
+#endif
+   AiBegin(AI_SESSION_BATCH);
+
+   AtUniverse* universe = AiUniverse();
+   AtNode* proc = AiNode(universe, AtString("usd"), AtString("proc"));
+   AiNodeSetStr(proc, AtString("filename"), AtString("scene.usda"));
+
+   // The free render mode initializes the scene, and therefore expands the procedurals,
+   // without rendering any pixel
+   AtRenderSession* session = AiRenderSession(universe);
+   AiRender(session, AI_RENDER_MODE_FREE);
+   AiRenderSessionDestroy(session);
+   AiUniverseDestroy(universe);
+
+   std::stringstream ss;
+   ss << std::ifstream("profile.json").rdbuf();
+   const std::string report = ss.str();
+
+   bool success = true;
+   for (const char* key : {"\"phases\"", "\"traverse\"", "\"prim_types\"", "\"Mesh\"", "\"count\": 1"}) {
+      if (report.find(key) == std::string::npos) {
+         AiMsgError("The profile report doesn't contain %s", key);
+         success = false;
+      }
+   }
+   AiEnd();
+   return success ? 0 : -1;
+}
@@ -0,0 +1,165 @@
+// Gaussian splat attributes are converted in bulk into the mapped Arnold arrays by the
+// ArnoldUsdSetGaussianSplat* functions shared by the usd procedural and the render delegate.
+// This checks the resulting arrays on a synthetic splat cloud, with enough splats to be converted
+// in parallel. When ARNOLD_USD_BENCHMARK is set, it uses a cloud of 2M splats instead,
+// and reports the conversion throughput for float and half precision inputs.
+//
+// Like test_2719, USD is statically linked in this executable through render_delegate, so
+// ARNOLD_PLUGIN_PATH is cleared to prevent usd_proc (with its own copy of USD) from being loaded.
+#include <ai.h>
+
+#include <shape_utils.h>
+
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/vt/types.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+bool g_success = true;
+
+bool Check(bool condition, const char* message)
+{
+    if (!condition) {
+        AiMsgError("[test_2725] %s", message);
+        g_success = false;
+    }
+    return condition;
+}
+
+bool IsClose(float a, float b) { return std::fabs(a - b) < 1e-3f; }
+
+// Degree 3 spherical harmonics
+constexpr size_t numCoeffs = 16;
+// Above the 1 << 16 splats converted serially, so the parallel conversions are checked
+size_t numSplats = 70000;
+bool benchmark = false;
+
+// Synthetic values, exactly representable with half precision
+float SyntheticValue(size_t i) { return static_cast<float>(i % 64) / 16.f - 2.f; }
+
+template <typename F>
+double TimeMs(F&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void ReportThroughput(const char* label, double ms)
+{
+    if (!benchmark)
+        return;
+    AiMsgInfo("[test_2725] %s : %.1f ms, %.1f M splats/s", label, ms,
+        ms > 0.0 ? static_cast<double>(numSplats) / (ms * 1000.0) : 0.0);
+}
+
+void CheckNode(AtNode* node)
+{
+    const AtArray* points = AiNodeGetArray(node, AtString("points"));
+    const AtArray* scales = AiNodeGetArray(node, AtString("gs_scale"));
+    const AtArray* opacities = AiNodeGetArray(node, AtString("gs_opacity"));
+    const AtArray* rotations = AiNodeGetArray(node, AtString("gs_rotation"));
+    const AtArray* sh = AiNodeGetArray(node, AtString("gs_sh"));
+    if (!Check(points && scales && opacities && rotations && sh, "Missing gaussian splat arrays"))
+        return;
+    Check(AiArrayGetNumElements(points) == numSplats, "Wrong amount of points");
+    Check(AiArrayGetNumElements(scales) == numSplats, "Wrong amount of scales");
+    Check(AiArrayGetNumElements(opacities) == numSplats, "Wrong amount of opacities");
+    Check(AiArrayGetNumElements(rotations) == numSplats * 4, "Wrong amount of rotation values");
+    Check(AiArrayGetNumElements(sh) == numSplats * numCoeffs, "Wrong amount of SH coefficients");
+
+    constexpr float C0 = 0.28209479177387814f;
+    for (size_t i : {size_t(0), size_t(1), numSplats / 2, numSplats - 1}) {
+        const float v = SyntheticValue(i);
+        Check(IsClose(AiArrayGetVec(points, i).y, v), "Wrong point value");
+        Check(IsClose(AiArrayGetVec(scales, i).z, v), "Wrong scale value");
+        Check(IsClose(AiArrayGetFlt(opacities, i), v), "Wrong opacity value");
+        // GfQuat(real, i, j, k) is stored as [i, j, k, real]
+        Check(IsClose(AiArrayGetFlt(rotations, i * 4), 0.f) && IsClose(AiArrayGetFlt(rotations, i * 4 + 1), v) &&
+                  IsClose(AiArrayGetFlt(rotations, i * 4 + 3), 1.f),
+            "Wrong rotation layout");
+        // Only the DC term of each splat is normalized
+        Check(IsClose(AiArrayGetRGB(sh, i * numCoeffs).r, v * C0 + 0.5f), "DC coefficient wasn't normalized");
+        Check(IsClose(AiArrayGetRGB(sh, i * numCoeffs + 1).r, v), "Higher order coefficient was modified");
+    }
+}
+
+} // namespace
+
+int main(int, char**)
+{
+#ifdef _WIN32
+    _putenv_s("ARNOLD_PLUGIN_PATH", "");
+#else
+    unsetenv("ARNOLD_PLUGIN_PATH");
+#endif
+    if (getenv("ARNOLD_USD_BENCHMARK")) {
+        benchmark = true;
+        numSplats = 2000000;
+    }
+
+    AiBegin();
+    AiMsgSetConsoleFlags(nullptr, AI_LOG_ALL);
+    {
+        VtVec3fArray positions(numSplats);
+        VtVec3hArray positionsh(numSplats);
+        VtFloatArray opacities(numSplats);
+        VtHalfArray opacitiesh(numSplats);
+        VtQuatfArray orientations(numSplats);
+        VtQuathArray orientationsh(numSplats);
+        VtVec3fArray shCoeffs(numSplats * numCoeffs);
+        VtVec3hArray shCoeffsh(numSplats * numCoeffs);
+        for (size_t i = 0; i < numSplats; ++i) {
+            const float v = SyntheticValue(i);
+            positions[i] = GfVec3f(v);
+            positionsh[i] = GfVec3h(positions[i]);
+            opacities[i] = v;
+            opacitiesh[i] = GfHalf(v);
+            orientations[i] = GfQuatf(1.f, v, 0.f, 0.f);
+            orientationsh[i] = GfQuath(orientations[i]);
+            for (size_t c = 0; c < numCoeffs; ++c) {
+                shCoeffs[i * numCoeffs + c] = GfVec3f(v);
+                shCoeffsh[i * numCoeffs + c] = GfVec3h(shCoeffs[i * numCoeffs + c]);
+            }
+        }
+
+        AtNode* node = AiNode(nullptr, AtString("points"), AtString("float_splats"));
+        AiNodeSetStr(node, AtString("mode"), AtString("gaussian"));
+        const double floatMs = TimeMs([&]() {
+            ArnoldUsdSetGaussianSplatVectors(node, AtString("points"), VtValue(positions));
+            ArnoldUsdSetGaussianSplatVectors(node, AtString("gs_scale"), VtValue(positions));
+            ArnoldUsdSetGaussianSplatOpacities(node, VtValue(opacities));
+            ArnoldUsdSetGaussianSplatRotations(node, VtValue(orientations));
+            ArnoldUsdSetGaussianSplatShCoefficients(node, VtValue(shCoeffs), true);
+        });
+        ReportThroughput("float attributes", floatMs);
+        CheckNode(node);
+
+        AtNode* nodeh = AiNode(nullptr, AtString("points"), AtString("half_splats"));
+        AiNodeSetStr(nodeh, AtString("mode"), AtString("gaussian"));
+        const double halfMs = TimeMs([&]() {
+            ArnoldUsdSetGaussianSplatVectors(nodeh, AtString("points"), VtValue(positionsh));
+            ArnoldUsdSetGaussianSplatVectors(nodeh, AtString("gs_scale"), VtValue(positionsh));
+            ArnoldUsdSetGaussianSplatOpacities(nodeh, VtValue(opacitiesh));
+            ArnoldUsdSetGaussianSplatRotations(nodeh, VtValue(orientationsh));
+            ArnoldUsdSetGaussianSplatShCoefficients(nodeh, VtValue(shCoeffsh), true);
+        });
+        ReportThroughput("half attributes", halfMs);
+        CheckNode(nodeh);
+
+        // Unsupported or empty values must leave the node untouched
+        Check(!ArnoldUsdSetGaussianSplatOpacities(node, VtValue(VtIntArray(4))), "Int opacities should be rejected");
+        Check(!ArnoldUsdSetGaussianSplatRotations(node, VtValue(VtQuatfArray())), "Empty rotations should be rejected");
+        Check(AiArrayGetNumElements(AiNodeGetArray(node, AtString("gs_opacity"))) == numSplats,
+            "Rejected values modified the node");
+    }
+    AiEnd();
+    return g_success ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+// Vertex primvars of non-linear curves are remapped to the amount of values Arnold expects
+// by ArnoldUsdCurvesData, shared by the usd procedural and the render delegate. This checks
+// the remapped values on a synthetic groom, with enough curves to be remapped in parallel.
+// When ARNOLD_USD_BENCHMARK is set, it uses a groom of 2M curves instead, and reports the
+// remapping throughput.
+//
+// Like test_2725, USD is statically linked in this executable through render_delegate, so
+// ARNOLD_PLUGIN_PATH is cleared to prevent usd_proc (with its own copy of USD) from being loaded.
+#include <ai.h>
+
+#include <shape_utils.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+bool g_success = true;
+
+bool Check(bool condition, const char* message)
+{
+    if (!condition) {
+        AiMsgError("[test_2726] %s", message);
+        g_success = false;
+    }
+    return condition;
+}
+
+bool IsClose(float a, float b) { return std::fabs(a - b) < 1e-3f; }
+
+constexpr int numVertices = 8;
+// 6 arnold values per curve, above the 1 << 16 values remapped serially
+size_t numCurves = 20000;
+bool benchmark = false;
+// Catmull-rom curves, 8 usd vertices are remapped to 6 arnold values
+constexpr int vmin = 4;
+constexpr int vstep = 1;
+constexpr int numArnoldVertices = (numVertices - vmin) / vstep + 2;
+
+// Synthetic values, increasing along each curve
+float SyntheticValue(size_t curve, int vertex) { return static_cast<float>(curve % 32) + static_cast<float>(vertex); }
+
+template <typename F>
+double TimeMs(F&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int, char**)
+{
+#ifdef _WIN32
+    _putenv_s("ARNOLD_PLUGIN_PATH", "");
+#else
+    unsetenv("ARNOLD_PLUGIN_PATH");
+#endif
+    if (getenv("ARNOLD_USD_BENCHMARK")) {
+        benchmark = true;
+        numCurves = 2000000;
+    }
+
+    AiBegin();
+    AiMsgSetConsoleFlags(nullptr, AI_LOG_ALL);
+    {
+        VtIntArray vertexCounts(numCurves, numVertices);
+        const size_t numPoints = numCurves * numVertices;
+        VtFloatArray widths(numPoints);
+        VtVec3fArray colors(numPoints);
+        VtIntArray ids(numPoints);
+        for (size_t curve = 0; curve < numCurves; ++curve) {
+            for (int vertex = 0; vertex < numVertices; ++vertex) {
+                const size_t i = curve * numVertices + vertex;
+                widths[i] = SyntheticValue(curve, vertex);
+                colors[i] = GfVec3f(SyntheticValue(curve, vertex));
+                ids[i] = vertex;
+            }
+        }
+
+        ArnoldUsdCurvesData curvesData(vmin, vstep, vertexCounts);
+        VtValue widthsValue(widths);
+        VtValue colorsValue(colors);
+        VtValue idsValue(ids);
+        const double ms = TimeMs([&]() {
+            curvesData.RemapCurvesVertexPrimvar<float, GfVec3f, int>(widthsValue);
+            curvesData.RemapCurvesVertexPrimvar<float, GfVec3f, int>(colorsValue);
+            curvesData.RemapCurvesVertexPrimvar<float, GfVec3f, int>(idsValue);
+        });
+        if (benchmark) {
+            AiMsgInfo("[test_2726] 3 primvars on %zu curves : %.1f ms, %.1f M curves/s", numCurves, ms,
+                ms > 0.0 ? static_cast<double>(numCurves * 3) / (ms * 1000.0) : 0.0);
+        }
+
+        const size_t numRemapped = numCurves * numArnoldVertices;
+        if (Check(widthsValue.IsHolding<VtFloatArray>() && colorsValue.IsHolding<VtVec3fArray>() &&
+                      idsValue.IsHolding<VtIntArray>(),
+                "Remapping changed the primvar types")) {
+            const auto& remappedWidths = widthsValue.UncheckedGet<VtFloatArray>();
+            const auto& remappedColors = colorsValue.UncheckedGet<VtVec3fArray>();
+            const auto& remappedIds = idsValue.UncheckedGet<VtIntArray>();
+            Check(remappedWidths.size() == numRemapped, "Wrong amount of remapped widths");
+            Check(remappedColors.size() == numRemapped, "Wrong amount of remapped colors");
+            Check(remappedIds.size() == numRemapped, "Wrong amount of remapped ids");
+            if (g_success) {
+                for (size_t curve : {size_t(0), size_t(1), numCurves / 2, numCurves - 1}) {
+                    for (int vertex = 0; vertex < numArnoldVertices; ++vertex) {
+                        const size_t i = curve * numArnoldVertices + vertex;
+                        // The values increase linearly along the curve, so interpolating them gives
+                        // the value at the same parametric position
+                        const float originalVertex = static_cast<float>(vertex) *
+                            static_cast<float>(numVertices - 1) / static_cast<float>(numArnoldVertices - 1);
+                        const float expected = static_cast<float>(curve % 32) + originalVertex;
+                        Check(IsClose(remappedWidths[i], expected), "Wrong interpolated width");
+                        Check(IsClose(remappedColors[i][1], expected), "Wrong interpolated color");
+                        // Types that can't be interpolated use the closest previous value, except
+                        // for the last one which is always the end of the curve
+                        const int expectedId = vertex == numArnoldVertices - 1 ? numVertices - 1
+                                                                                : static_cast<int>(std::floor(originalVertex));
+                        Check(remappedIds[i] == expectedId, "Wrong remapped id");
+                    }
+                }
+            }
+        }
+
+        // Values that were already remapped are left untouched
+        VtValue remappedValue = widthsValue;
+        curvesData.RemapCurvesVertexPrimvar<float>(remappedValue);
+        Check(remappedValue.UncheckedGet<VtFloatArray>().size() == numRemapped, "Remapped values were modified");
+
+        // Changing the topology in place requires invalidating the precomputed tables
+        vertexCounts = VtIntArray(2, numVertices + 1);
+        curvesData.SetBasis(vmin, vstep);
+        VtValue smallValue(VtFloatArray(2 * (numVertices + 1), 1.f));
+        curvesData.RemapCurvesVertexPrimvar<float>(smallValue);
+        Check(smallValue.UncheckedGet<VtFloatArray>().size() == 2 * (numArnoldVertices + 1),
+            "Topology change wasn't taken into account");
+    }
+    AiEnd();
+    return g_success ? 0 : 1;
+}
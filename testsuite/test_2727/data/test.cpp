@@ -0,0 +1,139 @@
+// The usd scene format collects the assets of a scene by scanning its layers in parallel, and stores
+// the references of each layer in the directory pointed by PROCEDURAL_ASSET_CACHE. Reading them back
+// from the cache must give the same assets as a serial scan without cache, and the references must be
+// resolved again, so that a texture published after the cache was written is found.
+#include <ai.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Scene formats can return their assets since Arnold 7.4.5
+#define ARNOLD_ASSETS_SUPPORTED (AI_VERSION_ARCH_NUM * 10000 + AI_VERSION_MAJOR_NUM * 100 + AI_VERSION_MINOR_NUM >= 70405)
+
+namespace {
+
+std::vector<std::string> g_dependencies;
+
+void MessageCallback(int logmask, int severity, const char* msg, AtParamValueMap* metadata, void* userPtr)
+{
+   static const char* prefix = "scene dependency: ";
+   const char* dependency = msg ? strstr(msg, prefix) : nullptr;
+   if (dependency)
+      g_dependencies.push_back(dependency + strlen(prefix));
+}
+
+void SetEnv(const char* name, const char* value)
+{
+#ifdef _WIN32
+   _putenv_s(name, value);
+#else
+   if (value[0])
+      setenv(name, value, 1);
+   else
+      unsetenv(name);
+#endif
+}
+
+// Returns the dependencies logged while collecting the assets of scene.usda. They are sorted,
+// since the order of the used layers of a stage depends on their addresses
+std::vector<std::string> CollectAssets()
+{
+   g_dependencies.clear();
+#if ARNOLD_ASSETS_SUPPORTED
+   AtArray* assets = AiSceneGetAssets("scene.usda", nullptr);
+   if (assets)
+      AiArrayDestroy(assets);
+#endif
+   std::sort(g_dependencies.begin(), g_dependencies.end());
+   return g_dependencies;
+}
+
+// Returns the path the late texture was resolved to, as logged before its authored reference
+std::string LateTexturePath(const std::vector<std::string>& dependencies)
+{
+   for (const std::string& dependency : dependencies) {
+      const size_t pos = dependency.find(" (ref: textures/late.tx,");
+      if (pos != std::string::npos)
+         return dependency.substr(0, pos);
+   }
+   return std::string();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+#if !ARNOLD_ASSETS_SUPPORTED
+   return 0;
+#endif
+   const bool serial = argc > 1 && strcmp(argv[1], "--serial") == 0;
+   if (serial) {
+      // The thread limit is read when usd is loaded with the scene format plugin
+      SetEnv("PXR_WORK_THREAD_LIMIT", "1");
+      SetEnv("PROCEDURAL_ASSET_CACHE", "");
+   } else {
+      // Start from an empty cache, and without the texture published by a previous run
+      std::error_code error;
+      std::filesystem::remove_all("asset_cache", error);
+      std::filesystem::remove("textures/late.tx", error);
+      SetEnv("PROCEDURAL_ASSET_CACHE", "asset_cache");
+   }
+   AiBegin(AI_SESSION_BATCH);
+   AiMsgRegisterCallback(MessageCallback, AI_LOG_ALL, nullptr);
+
+   if (serial) {
+      std::ofstream file("serial_dependencies.txt");
+      for (const std::string& dependency : CollectAssets())
+         file << dependency << "\n";
+      AiEnd();
+      return 0;
+   }
+
+   bool success = true;
+   const std::vector<std::string> scanned = CollectAssets();
+   // 2 sublayers and 5 textures
+   if (scanned.size() != 7) {
+      AiMsgError("The scan found %d dependencies instead of 7", (int)scanned.size());
+      success = false;
+   }
+   if (LateTexturePath(scanned) != "textures/late.tx") {
+      AiMsgError("The missing texture should not be resolved");
+      success = false;
+   }
+
+   // Scan the scene again in a serial process without cache
+   const std::string command = std::string("\"") + argv[0] + "\" --serial";
+   std::vector<std::string> serialScanned;
+   if (std::system(command.c_str()) == 0) {
+      std::ifstream file("serial_dependencies.txt");
+      std::string line;
+      while (std::getline(file, line))
+         serialScanned.push_back(line);
+   }
+   if (serialScanned != scanned) {
+      AiMsgError("The parallel scan doesn't match the serial scan");
+      success = false;
+   }
+
+   const std::vector<std::string> cached = CollectAssets();
+   if (cached != scanned) {
+      AiMsgError("The dependencies read from the cache don't match the scanned ones");
+      success = false;
+   }
+
+   // The layers are unchanged, but the cached references must be resolved again
+   std::ofstream("textures/late.tx").close();
+   const std::string latePath = LateTexturePath(CollectAssets());
+   if (latePath.empty() || latePath == "textures/late.tx") {
+      AiMsgError("The texture published after the first scan should be resolved");
+      success = false;
+   }
+
+   AiEnd();
+   return success ? 0 : -1;
+}